@@ -0,0 +1,433 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+#include "TFile.h"
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TSystem.h"
+
+#include "DataFormats/Provenance/interface/Provenance.h"
+
+#include "OSUT3Analysis/AnaTools/interface/BtagSFWeight.h"
+#include "OSUT3Analysis/AnaTools/interface/CommonUtils.h"
+#include "OSUT3Analysis/AnaTools/interface/SFWeight.h"
+#include "OSUT3Analysis/AnaTools/interface/ValueLookupTree.h"
+
+using namespace std;
+
+// Number of calls to operator new so far, from which the allocations per event
+// of each benchmark are reported.
+static unsigned long long nAllocations_ = 0;
+
+// Results which are otherwise unused are added to this, so that the compiler
+// cannot optimize away the calls which produce them.
+static volatile double sink_ = 0.0;
+
+void *
+operator new (size_t size)
+{
+  nAllocations_++;
+  void *p = malloc (size ? size : 1);
+  if (!p)
+    throw bad_alloc ();
+  return p;
+}
+
+void
+operator delete (void *p) noexcept
+{
+  free (p);
+}
+
+#if IS_VALID(muons) && IS_VALID(jets)
+
+struct SyntheticEvent
+{
+  vector<osu::Muon>  muons;
+  vector<osu::Jet>   jets;
+  vector<double>     jetCSV;
+  vector<double>     jetFlavor;
+  vector<double>     muonD0;
+  double             met;
+};
+
+void generateEvents (const unsigned, const unsigned, const unsigned, vector<SyntheticEvent> &);
+void setCollections (SyntheticEvent &, const edm::Provenance &, Collections &);
+string writeScaleFactorFile ();
+template<class T> unsigned long long runBenchmark (const string &, vector<SyntheticEvent> &, T);
+
+#endif
+
+void printHelp (const string &);
+void parseOptions (int, char *[], map<string, string> &, vector<string> &);
+
+int
+main (int argc, char *argv[])
+{
+  map<string, string> opt;
+  vector<string> argVector;
+  parseOptions (argc, argv, opt, argVector);
+  if (argVector.size () || opt.count ("help"))
+    {
+      printHelp (argv[0]);
+      return 0;
+    }
+
+#if IS_VALID(muons) && IS_VALID(jets)
+  unsigned nEvents = opt.count ("events") ? atoi (opt.at ("events").c_str ()) : 1000,
+           nMuons = opt.count ("muons") ? atoi (opt.at ("muons").c_str ()) : 4,
+           nJets = opt.count ("jets") ? atoi (opt.at ("jets").c_str ()) : 6;
+
+  // BtagSFWeight::weight loops over every combination of tagged jets.
+  if (nJets > 16)
+    {
+      cerr << "ERROR: the number of jets per event cannot exceed 16." << endl;
+      return 1;
+    }
+
+  TH1::AddDirectory (false);
+
+  vector<SyntheticEvent> events;
+  generateEvents (nEvents, nMuons, nJets, events);
+
+  edm::Provenance provenance;
+  Collections handles;
+
+  printf ("%u events with %u muons and %u jets each\n\n", nEvents, nMuons, nJets);
+  printf ("%-40s%15s%20s\n", "benchmark", "ns/object", "allocations/event");
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Parsing and evaluation of the cut strings, as done by the CutCalculator
+  // and the Plotter.
+  //////////////////////////////////////////////////////////////////////////////
+  const vector<pair<string, vector<string> > > expressions = {
+    {"pt > 25", {"muons"}},
+    {"fabs (eta) < 2.1", {"muons"}},
+    {"pt > 25 && fabs (eta) < 2.1 && charge != 0", {"muons"}},
+    {"pt > 30 && abs (eta) < 2.4", {"jets"}},
+    {"deltaR (muon, jet) > 0.4", {"jets", "muons"}},
+    {"invMass (muon, muon) > 60", {"muons", "muons"}},
+    // members which are not in the accessor table, and so are found through
+    // reflection: a chain of data members and a function
+    {"(pfIsolationR04_.sumChargedHadronPt + max (0.0, pfIsolationR04_.sumNeutralHadronEt + pfIsolationR04_.sumPhotonEt - 0.5 * pfIsolationR04_.sumPUPt)) / pt < 0.15", {"muons"}},
+    {"caloCompatibility > 0.5", {"muons"}}
+  };
+
+  runBenchmark ("ValueLookupTree parsing", events, [&] (SyntheticEvent &event) {
+    for (const auto &expression : expressions)
+      ValueLookupTree tree (expression.first, expression.second);
+    return expressions.size ();
+  });
+
+  vector<ValueLookupTree *> trees;
+  for (const auto &expression : expressions)
+    trees.push_back (new ValueLookupTree (expression.first, expression.second));
+
+  auto evaluateTrees = [&] (SyntheticEvent &event) {
+    unsigned nObjects = 0;
+    setCollections (event, provenance, handles);
+    for (const auto &tree : trees)
+      {
+        tree->setCollections (&handles);
+        nObjects += tree->evaluate ().size ();
+      }
+    return nObjects;
+  };
+
+  // The trees are evaluated once for every event before they are timed, which
+  // fills the combination tables, the members found through reflection, and
+  // the scratch space of each tree. After this, evaluating them must not
+  // allocate at all.
+  for (auto &event : events)
+    evaluateTrees (event);
+  const unsigned long long nEvaluationAllocations = runBenchmark ("ValueLookupTree evaluation", events, evaluateTrees);
+
+  runBenchmark ("anatools::getMember", events, [&] (SyntheticEvent &event) {
+    double sum = 0.0;
+    for (const auto &muon : event.muons)
+      sum += anatools::getMember (muon, "pt") + anatools::getMember (muon, "eta");
+    for (const auto &jet : event.jets)
+      sum += anatools::getMember (jet, "pt") + anatools::getMember (jet, "eta");
+    sink_ = sink_ + sum;
+    return 2 * (event.muons.size () + event.jets.size ());
+  });
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Flag propagation as in the CutCalculator: each cut sets the individual
+  // flags of its input collection, the cumulative flags are the logical AND
+  // with those of the previous cut, and the flags are then packed into the
+  // payload.
+  //////////////////////////////////////////////////////////////////////////////
+  const vector<string> flagCollections = {"jets", "muons"};
+  const vector<pair<ValueLookupTree *, string> > cuts = {
+    {trees.at (0), "muons"},
+    {trees.at (1), "muons"},
+    {trees.at (3), "jets"}
+  };
+  FlagMap individualFlags, cumulativeFlags;
+  PackedFlagMap packedIndividualFlags, packedCumulativeFlags;
+
+  runBenchmark ("cut flag propagation", events, [&] (SyntheticEvent &event) {
+    unsigned nObjects = 0;
+    setCollections (event, provenance, handles);
+    individualFlags.assign (cuts.size (), {});
+    cumulativeFlags.assign (cuts.size (), {});
+    for (unsigned i = 0; i < cuts.size (); i++)
+      {
+        ValueLookupTree * const tree = cuts.at (i).first;
+        const string &inputLabel = cuts.at (i).second;
+        tree->setCollections (&handles);
+
+        vector<pair<bool, bool> > &individual = individualFlags.at (i)[inputLabel];
+        for (const auto &value : tree->evaluate ())
+          {
+            double x = boost::get<double> (value);
+            individual.push_back (make_pair (x, !IS_INVALID(x)));
+          }
+
+        for (const auto &collection : flagCollections)
+          {
+            vector<pair<bool, bool> > &cumulative = cumulativeFlags.at (i)[collection];
+            cumulative = (collection == inputLabel) ? individual : vector<pair<bool, bool> > (collection == "muons" ? event.muons.size () : event.jets.size (), make_pair (true, true));
+            if (i > 0)
+              for (unsigned j = 0; j < cumulative.size (); j++)
+                cumulative.at (j).first = cumulative.at (j).first && cumulativeFlags.at (i - 1).at (collection).at (j).first;
+            nObjects += cumulative.size ();
+          }
+      }
+    anatools::packObjectFlags (individualFlags, flagCollections, packedIndividualFlags);
+    anatools::packObjectFlags (cumulativeFlags, flagCollections, packedCumulativeFlags);
+    return nObjects;
+  });
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Histogram filling as in the Plotter: each value to plot is evaluated by a
+  // ValueLookupTree and filled with the event weight.
+  //////////////////////////////////////////////////////////////////////////////
+  vector<ValueLookupTree *> plotTrees = {
+    new ValueLookupTree ("pt", {"muons"}),
+    new ValueLookupTree ("eta", {"muons"}),
+    new ValueLookupTree ("pt", {"jets"}),
+    new ValueLookupTree ("invMass (muon, muon)", {"muons", "muons"})
+  };
+  vector<TH1D *> histograms;
+  for (unsigned i = 0; i < plotTrees.size (); i++)
+    histograms.push_back (new TH1D (("h" + to_string (i)).c_str (), "", 100, -5.0, 500.0));
+  TH2D *muonEtaVsPt = new TH2D ("muonEtaVsPt", "", 100, 0.0, 500.0, 100, -3.0, 3.0);
+
+  runBenchmark ("histogram filling", events, [&] (SyntheticEvent &event) {
+    unsigned nObjects = 0;
+    setCollections (event, provenance, handles);
+    for (unsigned i = 0; i < plotTrees.size (); i++)
+      {
+        plotTrees.at (i)->setCollections (&handles);
+        for (const auto &value : plotTrees.at (i)->evaluate ())
+          histograms.at (i)->Fill (boost::get<double> (value), 1.0);
+        nObjects += plotTrees.at (i)->evaluate ().size ();
+      }
+    const vector<Leaf> &pt = plotTrees.at (0)->evaluate (),
+                       &eta = plotTrees.at (1)->evaluate ();
+    for (unsigned i = 0; i < pt.size () && i < eta.size (); i++)
+      muonEtaVsPt->Fill (boost::get<double> (pt.at (i)), boost::get<double> (eta.at (i)), 1.0);
+    return nObjects + pt.size ();
+  });
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Scale factor lookups.
+  //////////////////////////////////////////////////////////////////////////////
+  BtagSFWeight btagSFWeight;
+  runBenchmark ("BtagSFWeight::weight", events, [&] (SyntheticEvent &event) {
+    vector<double> efficiencies;
+    for (unsigned i = 0; i < event.jets.size (); i++)
+      efficiencies.push_back (0.7 * btagSFWeight.sflookup (event.jetCSV.at (i), event.jets.at (i).pt (), event.jetFlavor.at (i), event.jets.at (i).eta ()));
+    sink_ = sink_ + btagSFWeight.weight (efficiencies, 1);
+    return event.jets.size ();
+  });
+
+  string sfFile = writeScaleFactorFile ();
+  MuonSFWeight muonSFWeight (sfFile, "muonSF");
+  TriggerMetSFWeight triggerMetSFWeight (sfFile, "triggerMetSF");
+  ElectronSFWeight electronSFWeight ("53X", "loose");
+  TrackSFWeight trackSFWeight;
+  gSystem->Unlink (sfFile.c_str ());
+
+  runBenchmark ("SFWeight lookups", events, [&] (SyntheticEvent &event) {
+    double weight = triggerMetSFWeight.at (event.met);
+    for (unsigned i = 0; i < event.muons.size (); i++)
+      {
+        const osu::Muon &muon = event.muons.at (i);
+        weight *= muonSFWeight.at (muon.eta (), muon.pt ());
+        weight *= electronSFWeight.at (muon.eta (), muon.pt ());
+        weight *= trackSFWeight.at (event.muonD0.at (i));
+      }
+    sink_ = sink_ + weight;
+    return 1 + 3 * event.muons.size ();
+  });
+  //////////////////////////////////////////////////////////////////////////////
+
+  for (auto &tree : trees)
+    delete tree;
+  for (auto &tree : plotTrees)
+    delete tree;
+  for (auto &histogram : histograms)
+    delete histogram;
+  delete muonEtaVsPt;
+
+  if (nEvaluationAllocations)
+    {
+      cerr << "ERROR: ValueLookupTree evaluation made " << nEvaluationAllocations << " allocations after warm-up, instead of none." << endl;
+      return 1;
+    }
+#else
+  cerr << "ERROR: muons and jets must be valid collections in this data format." << endl;
+  return 1;
+#endif
+
+  return 0;
+}
+
+#if IS_VALID(muons) && IS_VALID(jets)
+
+void
+generateEvents (const unsigned nEvents, const unsigned nMuons, const unsigned nJets, vector<SyntheticEvent> &events)
+{
+  mt19937 generator (12345);
+  exponential_distribution<double> pt (1.0 / 40.0);
+  uniform_real_distribution<double> eta (-2.5, 2.5), phi (-M_PI, M_PI), csv (0.0, 1.0), d0 (-0.05, 0.05);
+  discrete_distribution<int> flavor ({60, 20, 20});
+  const int flavors[3] = {0, 4, 5};
+
+  events.resize (nEvents);
+  for (auto &event : events)
+    {
+      for (unsigned i = 0; i < nMuons; i++)
+        {
+          osu::Muon muon;
+          muon.setP4 (reco::Candidate::PolarLorentzVector (10.0 + pt (generator), eta (generator), phi (generator), 0.1056583715));
+          muon.setCharge (i % 2 ? 1 : -1);
+          event.muons.push_back (muon);
+          event.muonD0.push_back (d0 (generator));
+        }
+      for (unsigned i = 0; i < nJets; i++)
+        {
+          osu::Jet jet;
+          jet.setP4 (reco::Candidate::PolarLorentzVector (20.0 + pt (generator), eta (generator), phi (generator), 5.0));
+          event.jets.push_back (jet);
+          event.jetCSV.push_back (csv (generator));
+          event.jetFlavor.push_back (flavors[flavor (generator)]);
+        }
+      event.met = pt (generator);
+    }
+}
+
+void
+setCollections (SyntheticEvent &event, const edm::Provenance &provenance, Collections &handles)
+{
+  handles.muons = edm::Handle<vector<osu::Muon> > (&event.muons, &provenance);
+  handles.jets = edm::Handle<vector<osu::Jet> > (&event.jets, &provenance);
+  for (auto &table : handles.combinationTables)
+    table.second.isFilled = false;
+  handles.mergedEventvariablesAreFilled = false;
+}
+
+// Writes histograms for the scale factors read from files into a temporary
+// file, and returns its name.
+string
+writeScaleFactorFile ()
+{
+  string fileName = string (gSystem->TempDirectory ()) + "/benchmarkAnaTools_" + to_string (gSystem->GetPid ()) + ".root";
+  TFile *fout = TFile::Open (fileName.c_str (), "recreate");
+
+  TH2F *muonSF = new TH2F ("muonSF", "", 4, 0.0, 2.4, 8, 20.0, 500.0);
+  TH1F *triggerMetSF = new TH1F ("triggerMetSF", "", 50, 0.0, 500.0);
+  for (int i = 1; i <= muonSF->GetNbinsX (); i++)
+    for (int j = 1; j <= muonSF->GetNbinsY (); j++)
+      muonSF->SetBinContent (i, j, 0.95 + 0.01 * j);
+  for (int i = 1; i <= triggerMetSF->GetNbinsX (); i++)
+    triggerMetSF->SetBinContent (i, 1.0 - 0.5 / i);
+
+  fout->WriteTObject (muonSF);
+  fout->WriteTObject (triggerMetSF);
+  fout->Close ();
+
+  delete muonSF;
+  delete triggerMetSF;
+  delete fout;
+
+  return fileName;
+}
+
+// Runs the given function over every event and prints the time per object
+// processed and the number of allocations per event. The function returns the
+// number of objects it processed in the event. Returns the total number of
+// allocations.
+template<class T> unsigned long long
+runBenchmark (const string &name, vector<SyntheticEvent> &events, T function)
+{
+  unsigned long long nObjects = 0,
+                     nAllocations = nAllocations_;
+  auto start = chrono::steady_clock::now ();
+  for (auto &event : events)
+    nObjects += function (event);
+  auto stop = chrono::steady_clock::now ();
+  nAllocations = nAllocations_ - nAllocations;
+
+  double ns = chrono::duration<double, nano> (stop - start).count ();
+  printf ("%-40s%15.1f%20.1f\n", name.c_str (), nObjects ? ns / nObjects : 0.0, events.empty () ? 0.0 : nAllocations / (double) events.size ());
+
+  return nAllocations;
+}
+
+#endif
+
+void
+printHelp (const string &exeName)
+{
+  printf ("Usage: %s [OPTION]...\n", exeName.c_str ());
+  printf ("Times the most frequently called parts of AnaTools on synthetic events, and\n");
+  printf ("prints the time per object and the number of allocations per event for each.\n");
+  printf ("Fails if evaluating the cut strings allocates after the first pass over the\n");
+  printf ("events.\n");
+  printf ("\n");
+  printf ("%-29s%s\n", "  -h, --help", "print this help message");
+  printf ("%-29s%s\n", "  -j, --jets NJETS", "number of jets per event (default: 6)");
+  printf ("%-29s%s\n", "  -m, --muons NMUONS", "number of muons per event (default: 4)");
+  printf ("%-29s%s\n", "  -n, --events NEVENTS", "number of events (default: 1000)");
+}
+
+void
+parseOptions (int argc, char *argv[], map<string, string> &opt, vector<string> &argVector)
+{
+  for (int i = 1; i < argc; i++)
+    {
+      if (argv[i][0] != '-')
+        {
+          argVector.push_back (argv[i]);
+          continue;
+        }
+      int offset = 1;
+      if (argv[i][1] == '-')
+        offset++;
+      string key = argv[i] + offset,
+             value = "";
+      if (key == "h")
+        key = "help";
+      if (key == "j")
+        key = "jets";
+      if (key == "m")
+        key = "muons";
+      if (key == "n")
+        key = "events";
+      if ((key == "jets" || key == "muons" || key == "events") && i + 1 < argc)
+        value = argv[i++ + 1];
+      opt[key] = value;
+    }
+}
@@ -7,6 +7,9 @@
 #include <vector>
 #include <cmath>
 #include <fstream>
+#include <limits>
+
+#include <sys/stat.h>
 
 #include "TFile.h"
 #include "TDirectoryFile.h"
@@ -21,6 +24,7 @@ using namespace std;
 
 string bigInt (double, string option = "");
 string bigEff (double);
+TH1D *readCachedCutFlow (const string &, const string &);
 void printHelp (const string &exeName);
 void parseOptions (int, char **, map<string, string> &, vector<string> &);
 void ReplaceStringInPlace(std::string& subject, const std::string& search,
@@ -86,16 +90,6 @@ main (int argc, char *argv[])
       string fileToOpen = fileName;
       if (sb && (fileName[0] == '<' || fileName[0] == '>'))
         fileToOpen = fileName.substr (1, fileName.size () - 1);
-      TFile *fin;
-      if (!(fin = TFile::Open (fileToOpen.c_str ())))
-        {
-          cerr << "Failed to open " << fileToOpen << "!" << endl;
-          return 0;
-        }
-      TIter next0 (fin->GetListOfKeys ());
-      TObject *obj0;
-      TH1D *cutFlow = 0; //, *upperLimit = 0;
-
       double yieldTheory = -99;
       double xsec = -99;
       if (opt.count ("xsecTheory")) {
@@ -111,48 +105,27 @@ main (int argc, char *argv[])
         cerr << "Found for fileName: " << fileName << ": xsec = " << xsec << ", yieldTheory = " << yieldTheory << endl;
       }
 
-      while (!cutFlow && (obj0 = next0 ()))
+      // The cut flows written to the sidecar file by makeCutFlows.py or
+      // makeYieldsTables.py are used if they are still up to date, so that the
+      // ROOT file does not need to be opened at all.
+      TH1D *cutFlow = readCachedCutFlow (fileToOpen, histName);
+      if (!cutFlow)
         {
-          string obj0Class = ((TKey *) obj0)->GetClassName (),
-                 obj0Name = obj0->GetName ();
-
-          if (obj0Class == "TDirectoryFile")
+          TFile *fin;
+          if (!(fin = TFile::Open (fileToOpen.c_str ())))
             {
-              TDirectoryFile *dir = (TDirectoryFile *) fin->Get (obj0Name.c_str ());
-              TIter next1 (dir->GetListOfKeys ());
-              TObject *obj1;
-              while (!cutFlow && (obj1 = next1 ()))
-                {
-                  string obj1Class = ((TKey *) obj1)->GetClassName (),
-                         obj1Name = obj1->GetName ();
-
-                  TString objFullName = obj0->GetName();
-                  objFullName += TString("/") + TString(obj1->GetName());
-
-                  TString histNameStr = histName;
-
-                  if (obj1Class == "TH1D" && objFullName == histNameStr)
-                    {
-                      cutFlow = (TH1D *) dir->Get (obj1Name.c_str ());
-                      if (!cutFlow) cerr << "Problem accessing cutFlow" << endl;
-                      //                      upperLimit = (TH1D *) dir->Get ((obj1Name + "UpperLimit").c_str ());
-                    }
-                }
+              cerr << "Failed to open " << fileToOpen << "!" << endl;
+              return 0;
             }
+          cutFlow = dynamic_cast<TH1D *> (fin->Get (histName.c_str ()));
+          if (!cutFlow)
+            {
+              cerr << "Did not find a histogram named " << histName << " in " << fileToOpen << "!" << endl;
+              return 0;
+            }
+          cutFlow->SetDirectory (0);
+          fin->Close ();
         }
-      if (!cutFlow)
-        {
-          cerr << "Did not find a histogram named " << histName << " in " << fileToOpen << "!" << endl;
-          return 0;
-        }
-//       if (!upperLimit)
-//         {
-//           cerr << "Did not find a histogram named " << (histName + "UpperLimit") << " in " << fileToOpen << "!" << endl;
-//           return 0;
-//         }
-      cutFlow->SetDirectory (0);
-      //      upperLimit->SetDirectory (0);
-      fin->Close ();
 
       TAxis *x = cutFlow->GetXaxis ();
       table.push_back (vector<string> ());
@@ -505,6 +478,67 @@ bigEff (double n)
   return num;
 }
 
+TH1D *
+readCachedCutFlow (const string &fileName, const string &histName)
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Returns the named cut flow from the sidecar file of the given ROOT file, as
+  // written by OSUT3Analysis/Configuration/python/cutFlowReader.py, or NULL if
+  // there is no sidecar, it is out of date, or it does not have the cut flow.
+  //////////////////////////////////////////////////////////////////////////////
+  string sidecarName = fileName;
+  if (sidecarName.size () >= 5 && sidecarName.substr (sidecarName.size () - 5) == ".root")
+    sidecarName.resize (sidecarName.size () - 5);
+  sidecarName += ".cutFlows";
+
+  struct stat status;
+  ifstream sidecar (sidecarName.c_str ());
+  if (!sidecar || stat (fileName.c_str (), &status))
+    return NULL;
+
+  string header;
+  long long size, mtime;
+  if (!(sidecar >> header >> size >> mtime) || header != "cutFlows" || size != (long long) status.st_size || mtime != (long long) status.st_mtime)
+    return NULL;
+  sidecar.ignore (numeric_limits<streamsize>::max (), '\n');
+
+  string line;
+  while (getline (sidecar, line))
+    {
+      size_t tab = line.find ('\t');
+      if (tab == string::npos)
+        return NULL;
+      string path = line.substr (0, tab);
+      int nBins = atoi (line.substr (tab + 1).c_str ());
+      if (path != histName)
+        {
+          for (int i = 0; i < nBins; i++)
+            sidecar.ignore (numeric_limits<streamsize>::max (), '\n');
+          continue;
+        }
+
+      TH1D *cutFlow = new TH1D (histName.c_str (), "", nBins, 0.0, nBins);
+      cutFlow->SetDirectory (0);
+      for (int i = 1; i <= nBins && getline (sidecar, line); i++)
+        {
+          size_t first = line.find ('\t'),
+                 second = line.find ('\t', first + 1);
+          if (first == string::npos || second == string::npos)
+            {
+              delete cutFlow;
+              return NULL;
+            }
+          cutFlow->GetXaxis ()->SetBinLabel (i, line.substr (0, first).c_str ());
+          cutFlow->SetBinContent (i, atof (line.substr (first + 1, second - first - 1).c_str ()));
+          cutFlow->SetBinError (i, atof (line.substr (second + 1).c_str ()));
+        }
+      return cutFlow;
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  return NULL;
+}
+
 void
 printHelp (const string &exeName)
 {
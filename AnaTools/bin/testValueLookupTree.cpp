@@ -0,0 +1,310 @@
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "TSystem.h"
+
+#include "OSUT3Analysis/AnaTools/interface/ValueLookupTree.h"
+
+using namespace std;
+
+// Written in place of the tree for expressions which cannot be parsed.
+static const string INVALID_TREE = "INVALID";
+
+void findConfigurations (const string &, vector<string> &);
+void collectExpressions (const string &, map<string, string> &);
+bool readTrees (const string &, map<string, string> &);
+bool writeTrees (const string &, const map<string, string> &);
+void printHelp (const string &);
+void parseOptions (int, char *[], map<string, string> &, vector<string> &);
+
+int
+main (int argc, char *argv[])
+{
+  map<string, string> opt;
+  vector<string> argVector;
+  parseOptions (argc, argv, opt, argVector);
+  if (argVector.size () || opt.count ("help"))
+    {
+      printHelp (argv[0]);
+      return 0;
+    }
+
+  const char * const cmsswBase = gSystem->Getenv ("CMSSW_BASE");
+  if (!opt.count ("base") && !cmsswBase)
+    {
+      cerr << "ERROR: CMSSW_BASE is not set. Please specify the package with '-b'." << endl;
+      return 1;
+    }
+  const string base = opt.count ("base") ? opt.at ("base") : string (cmsswBase) + "/src/OSUT3Analysis",
+               treeFile = opt.count ("trees") ? opt.at ("trees") : base + "/AnaTools/test/valueLookupTreeCorpus.txt";
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Collect the cut strings and input variables in the configurations, and
+  // build the tree for each of them.
+  //////////////////////////////////////////////////////////////////////////////
+  vector<string> configurations;
+  findConfigurations (base + "/Configuration", configurations);
+  findConfigurations (base + "/ExampleAnalysis", configurations);
+
+  map<string, string> trees;
+  for (const auto &configuration : configurations)
+    collectExpressions (configuration, trees);
+  if (trees.empty ())
+    {
+      cerr << "ERROR: no expressions found in " << base << "/Configuration or " << base << "/ExampleAnalysis." << endl;
+      return 1;
+    }
+
+  for (auto &tree : trees)
+    {
+      ValueLookupTree valueLookupTree (tree.first, {});
+      tree.second = valueLookupTree.isValid () ? valueLookupTree.print () : INVALID_TREE;
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  if (opt.count ("update"))
+    {
+      if (!writeTrees (treeFile, trees))
+        return 1;
+      printf ("Wrote the trees for %lu expressions to %s.\n", trees.size (), treeFile.c_str ());
+      return 0;
+    }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Compare the trees with the expected ones, and fail on any difference,
+  // including expressions which were added to or removed from the
+  // configurations.
+  //////////////////////////////////////////////////////////////////////////////
+  map<string, string> expectedTrees;
+  if (!readTrees (treeFile, expectedTrees))
+    return 1;
+
+  unsigned nDifferences = 0;
+  for (const auto &tree : trees)
+    {
+      auto expectedTree = expectedTrees.find (tree.first);
+      if (expectedTree == expectedTrees.end ())
+        printf ("NEW:        \"%s\"\n  found:    %s\n", tree.first.c_str (), tree.second.c_str ());
+      else if (expectedTree->second != tree.second)
+        printf ("DIFFERENT:  \"%s\"\n  expected: %s\n  found:    %s\n", tree.first.c_str (), expectedTree->second.c_str (), tree.second.c_str ());
+      else
+        continue;
+      nDifferences++;
+    }
+  for (const auto &expectedTree : expectedTrees)
+    {
+      if (trees.count (expectedTree.first))
+        continue;
+      printf ("REMOVED:    \"%s\"\n  expected: %s\n", expectedTree.first.c_str (), expectedTree.second.c_str ());
+      nDifferences++;
+    }
+
+  if (nDifferences)
+    {
+      printf ("\n%u of %lu expressions differ from %s.\n", nDifferences, trees.size (), treeFile.c_str ());
+      printf ("If the new trees are correct, rerun with '--update' and commit the result.\n");
+      return 1;
+    }
+  printf ("The trees for all %lu expressions match %s.\n", trees.size (), treeFile.c_str ());
+  //////////////////////////////////////////////////////////////////////////////
+
+  return 0;
+}
+
+// Appends the Python files in the given directory and its subdirectories to
+// the list of configurations.
+void
+findConfigurations (const string &directory, vector<string> &configurations)
+{
+  void *dir = gSystem->OpenDirectory (directory.c_str ());
+  if (!dir)
+    return;
+  vector<string> entries;
+  while (const char * const entry = gSystem->GetDirEntry (dir))
+    entries.push_back (entry);
+  gSystem->FreeDirectory (dir);
+
+  for (const auto &entry : entries)
+    {
+      if (entry.empty () || entry.at (0) == '.')
+        continue;
+      const string path = directory + "/" + entry;
+      FileStat_t stat;
+      if (gSystem->GetPathInfo (path.c_str (), stat))
+        continue;
+      if (R_ISDIR (stat.fMode))
+        findConfigurations (path, configurations);
+      else if (path.size () > 3 && path.substr (path.size () - 3) == ".py")
+        configurations.push_back (path);
+    }
+}
+
+// Adds every cutString, inputVariables and valueToPrint string in the given
+// configuration to the map of expressions, skipping those which are commented
+// out. Only the escapes found in the configurations are handled: a backslash at
+// the end of a line continues the string, and any other escaped character
+// stands for itself.
+void
+collectExpressions (const string &configuration, map<string, string> &expressions)
+{
+  ifstream fin (configuration);
+  const string source ((istreambuf_iterator<char> (fin)), istreambuf_iterator<char> ());
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Drop the comments, which run from a '#' outside of any string to the end
+  // of the line.
+  //////////////////////////////////////////////////////////////////////////////
+  string text;
+  char quote = 0;
+  for (size_t i = 0; i < source.size (); i++)
+    {
+      const char c = source.at (i);
+      if (!quote && c == '#')
+        {
+          i = source.find ('\n', i);
+          if (i == string::npos)
+            break;
+        }
+      else if (quote && c == '\\' && i + 1 < source.size ())
+        {
+          text += c;
+          i++;
+        }
+      else if (quote && c == quote)
+        quote = 0;
+      else if (!quote && (c == '"' || c == '\''))
+        quote = c;
+      text += source.at (i);
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Parameters built from Python variables, e.g., muonPFIsolation + " < 0.15",
+  // cannot be evaluated here and are skipped.
+  //////////////////////////////////////////////////////////////////////////////
+  static const regex parameter ("\\b(cutString|inputVariables|valueToPrint)\\s*=\\s*cms\\.v?string\\s*\\(");
+  for (sregex_iterator match (text.begin (), text.end (), parameter); match != sregex_iterator (); match++)
+    {
+      vector<string> strings;
+      bool onlyStrings = true;
+      for (size_t i = match->position () + match->length (); i < text.size () && text.at (i) != ')'; i++)
+        {
+          const char quote = text.at (i);
+          if (quote != '"' && quote != '\'')
+            {
+              onlyStrings = onlyStrings && (isspace (quote) || quote == ',');
+              continue;
+            }
+          string expression;
+          for (i++; i < text.size () && text.at (i) != quote; i++)
+            {
+              if (text.at (i) == '\\' && i + 1 < text.size () && text.at (++i) == '\n')
+                continue;
+              expression += text.at (i);
+            }
+          strings.push_back (expression);
+        }
+      if (onlyStrings)
+        for (const auto &expression : strings)
+          expressions[expression];
+    }
+  //////////////////////////////////////////////////////////////////////////////
+}
+
+// Reads the file of trees, in which each line holds an expression and its tree
+// separated by a tab, and lines starting with '#' are comments.
+bool
+readTrees (const string &treeFile, map<string, string> &trees)
+{
+  ifstream fin (treeFile);
+  if (!fin.is_open ())
+    {
+      cerr << "ERROR: could not open " << treeFile << ". Please run with '--update' to create it." << endl;
+      return false;
+    }
+  string line;
+  while (getline (fin, line))
+    {
+      if (line.empty () || line.at (0) == '#')
+        continue;
+      const size_t tab = line.find ('\t');
+      if (tab == string::npos)
+        {
+          cerr << "ERROR: malformed line in " << treeFile << ": " << line << endl;
+          return false;
+        }
+      trees[line.substr (0, tab)] = line.substr (tab + 1);
+    }
+  return true;
+}
+
+bool
+writeTrees (const string &treeFile, const map<string, string> &trees)
+{
+  ofstream fout (treeFile);
+  if (!fout.is_open ())
+    {
+      cerr << "ERROR: could not open " << treeFile << " for writing." << endl;
+      return false;
+    }
+  fout << "# The trees built by ValueLookupTree for the cut strings and input variables in" << endl;
+  fout << "# the configurations in Configuration and ExampleAnalysis, which are checked by" << endl;
+  fout << "# testValueLookupTree. Each line holds an expression and its tree, separated by" << endl;
+  fout << "# a tab; the tree is " << INVALID_TREE << " if the expression cannot be parsed. Do not edit by" << endl;
+  fout << "# hand; rerun \"testValueLookupTree --update\" and check the differences instead." << endl;
+  for (const auto &tree : trees)
+    fout << tree.first << "\t" << tree.second << endl;
+  return true;
+}
+
+void
+printHelp (const string &exeName)
+{
+  printf ("Usage: %s [OPTION]...\n", exeName.c_str ());
+  printf ("Builds the ValueLookupTree for every cut string and input variable in the\n");
+  printf ("configurations in Configuration and ExampleAnalysis, and fails if any tree\n");
+  printf ("differs from those in the given file.\n");
+  printf ("\n");
+  printf ("%-29s%s\n", "  -b, --base DIRECTORY", "path to the OSUT3Analysis package");
+  printf ("%-29s%s\n", "", "(default: $CMSSW_BASE/src/OSUT3Analysis)");
+  printf ("%-29s%s\n", "  -h, --help", "print this help message");
+  printf ("%-29s%s\n", "  -t, --trees FILE", "file of expected trees");
+  printf ("%-29s%s\n", "", "(default: AnaTools/test/valueLookupTreeCorpus.txt)");
+  printf ("%-29s%s\n", "  -u, --update", "write the trees to the file instead of comparing");
+}
+
+void
+parseOptions (int argc, char *argv[], map<string, string> &opt, vector<string> &argVector)
+{
+  for (int i = 1; i < argc; i++)
+    {
+      if (argv[i][0] != '-')
+        {
+          argVector.push_back (argv[i]);
+          continue;
+        }
+      int offset = 1;
+      if (argv[i][1] == '-')
+        offset++;
+      string key = argv[i] + offset,
+             value = "";
+      if (key == "b")
+        key = "base";
+      if (key == "h")
+        key = "help";
+      if (key == "t")
+        key = "trees";
+      if (key == "u")
+        key = "update";
+      if ((key == "base" || key == "trees") && i + 1 < argc)
+        value = argv[i++ + 1];
+      opt[key] = value;
+    }
+}
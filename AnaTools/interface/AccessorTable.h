@@ -0,0 +1,63 @@
+// Table of compiled accessors for the members of the osu:: collection classes.
+//
+// The table itself is generated by AnaTools/scripts/generateAccessorTable.py
+// into AnaTools/src/AccessorTable.cc, which declares one accessor per member
+// name and registers it for each class. An accessor is only registered if the
+// member exists, is public and returns an arithmetic type for that class, so
+// names which do not apply in the current data format simply drop out.
+
+#ifndef ACCESSOR_TABLE
+
+#define ACCESSOR_TABLE
+
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+using namespace std;
+
+namespace anatools
+{
+  typedef double (*Accessor) (const void *);
+  typedef unordered_map<string, unordered_map<string, Accessor> > AccessorTable;
+
+  // Returns the accessor for the given member of the given class, e.g.,
+  // ("osu::Muon", "pt"), or NULL if there is none and reflection must be used.
+  Accessor getAccessor (const string &, const string &);
+
+  // Registers every generated accessor which compiles for the data format in
+  // use. Defined in the generated AccessorTable.cc.
+  void fillAccessorTable (AccessorTable &);
+
+  // Only used in unevaluated contexts, to require an arithmetic return type.
+  template<class R> typename enable_if<is_arithmetic<R>::value || is_enum<R>::value>::type requireArithmetic (R);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Declares a struct NAME##Function (NAME##Data) whose make<T> () returns a
+// pointer to a function evaluating the member function (data member) NAME of
+// an object of class T, or NULL if T has no such member returning an
+// arithmetic type.
+////////////////////////////////////////////////////////////////////////////////
+#define MEMBER_FUNCTION_ACCESSOR(NAME)                                                                    \
+  struct NAME##Function                                                                                   \
+  {                                                                                                       \
+    template<class T> static double call (const void *obj) { return static_cast<const T *> (obj)->NAME (); } \
+    template<class T> static auto make (int) -> decltype (anatools::requireArithmetic (static_cast<const T *> (nullptr)->NAME ()), anatools::Accessor ()) { return &call<T>; } \
+    template<class T> static anatools::Accessor make (long) { return NULL; }                             \
+  };
+
+#define DATA_MEMBER_ACCESSOR(NAME)                                                                        \
+  struct NAME##Data                                                                                       \
+  {                                                                                                       \
+    template<class T> static double call (const void *obj) { return static_cast<const T *> (obj)->NAME; } \
+    template<class T> static auto make (int) -> decltype (anatools::requireArithmetic (static_cast<const T *> (nullptr)->NAME), anatools::Accessor ()) { return &call<T>; } \
+    template<class T> static anatools::Accessor make (long) { return NULL; }                             \
+  };
+
+#define REGISTER_ACCESSOR(TABLE, CLASS, NAME, KIND)                                                       \
+  if (anatools::Accessor accessor = NAME##KIND::make<CLASS> (0))                                          \
+    TABLE[#CLASS][#NAME] = accessor;
+////////////////////////////////////////////////////////////////////////////////
+
+#endif
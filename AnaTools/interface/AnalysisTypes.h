@@ -1,6 +1,8 @@
 #ifndef ANALYSIS_TYPES
 #define ANALYSIS_TYPES
 
+#include <unordered_map>
+
 #include "boost/variant.hpp"
 
 #include "DataFormats/Common/interface/Handle.h"
@@ -30,6 +32,8 @@
 
 
 class ValueLookupTree;
+class TH1;
+class SparseHistogram;
 
 typedef boost::variant<double, string> Leaf;
 
@@ -51,7 +55,10 @@ struct Cut
 
 typedef vector<Cut> Cuts;
 
-struct CutCalculatorPayload
+// Flags calculated by the CutCalculator for one channel. This is the working
+// form used while evaluating the cuts; it is packed into a CutSchema and a
+// CutCalculatorPayload before being put into the run and the event.
+struct CutFlags
 {
   FlagMap         cumulativeObjectFlags;
   FlagMap         individualObjectFlags;
@@ -77,6 +84,76 @@ struct CutCalculatorPayload
   vector<string>  metFilters;
 };
 
+// A vector of bits packed into 32-bit words.
+struct FlagBits
+{
+  vector<unsigned>  words;
+  unsigned          nBits = 0;
+
+  void push_back (const bool bit)
+  {
+    if (!(nBits & 31))
+      words.push_back (0);
+    if (bit)
+      words.back () |= (1u << (nBits & 31));
+    nBits++;
+  }
+  bool at (const unsigned i) const { return (words.at (i >> 5) >> (i & 31)) & 1u; }
+  unsigned size () const { return nBits; }
+  bool empty () const { return !nBits; }
+  void clear () { words.clear (); nBits = 0; }
+};
+
+// Object flags for every cut and every collection of a CutSchema, stored as
+// one block per cut and collection. Since most cuts only change the flags of
+// a few collections, a block which is identical to that for the previous cut
+// is not stored again.
+struct PackedFlagMap
+{
+  enum BlockCode { ABSENT = 0, SAME_AS_PREVIOUS_CUT = 1, STORED = 2 };
+
+  vector<unsigned char>  blockCodes;  // one per cut and collection
+  vector<unsigned>       blockSizes;  // number of objects in each stored block
+  FlagBits               flags;       // flag and validity bits of each object in each stored block
+};
+
+// Names and strings describing the cuts and triggers of a channel, which are
+// constant for a job and so are put into each run rather than each event.
+struct CutSchema
+{
+  vector<string>  cutNames;
+  vector<string>  cutStrings;
+  vector<string>  inputLabels;
+  vector<string>  collections;         // collections with object flags, in the order they are packed
+  vector<string>  triggers;
+  vector<string>  triggersToVeto;
+  vector<string>  triggerFilters;
+  vector<string>  triggersInMenu;
+  vector<string>  metFilters;
+};
+
+// Per-event flags from the CutCalculator. The flags are indexed in the same
+// order as the names in the CutSchema with the same label.
+struct CutCalculatorPayload
+{
+  bool            cutDecision;
+  bool            cutsDecision;        // whether event passes all cuts, without trigger
+  bool            eventDecision;       // whether event passes all cuts and the trigger
+  bool            isValid;
+  bool            triggerDecision;
+  bool            triggerFilterDecision;
+  bool            metFilterDecision;
+  PackedFlagMap   cumulativeObjectFlags;
+  PackedFlagMap   individualObjectFlags;
+  FlagBits        cumulativeEventFlags;
+  FlagBits        individualEventFlags;
+  FlagBits        triggerFlags;
+  FlagBits        vetoTriggerFlags;
+  FlagBits        triggerFilterFlags;
+  FlagBits        triggerInMenuFlags;
+  FlagBits        metFilterFlags;
+};
+
 struct HistoDef {
   vector<string> inputCollections;
   string inputLabel;
@@ -96,6 +173,10 @@ struct HistoDef {
   vector<ValueLookupTree *> valueLookupTrees;
   int dimensions;
   bool weight;
+  vector<TH1 *> histograms; // one per weight set, with the nominal one first
+  bool lazy; // histograms are only booked on the first fill
+  bool sparse; // 2D and 3D histograms are filled into sparseHistograms instead
+  vector<SparseHistogram *> sparseHistograms; // one per weight set, with the nominal one first
 };
 
 struct BranchDef {
@@ -134,8 +215,49 @@ struct Node
   Node            *parent;
   string          value;
   vector<Node *>  branches;
+  int             eventvariableIndex; // index in Collections::mergedEventvariables, or -1
 };
 
+// Table for converting between the local index of an object within a
+// single-object collection and the global indices of the combinations which
+// contain it within a composite collection, e.g., muon-muon-jets. The
+// single-object collections are sorted as in anatools::getSingleObjects, and
+// the local index within the i-th of them is
+//   (globalIndex / strides.at (i)) % collectionSizes.at (i).
+struct CombinationTable
+{
+  vector<string>    singleObjects;
+  vector<unsigned>  collectionSizes;
+  vector<unsigned>  strides;
+  unsigned          nCombinations;
+  bool              isFilled = false;  // whether the sizes are those of the current event
+
+  // Sorted global indices containing each local index of a single-object
+  // collection, filled on first use in each event. The vectors are kept from
+  // one event to the next, so that they only allocate when they grow.
+  struct GlobalIndices
+  {
+    vector<unsigned>           singleObjectIndices;  // positions of the collection in singleObjects
+    bool                       isFilled = false;
+    unsigned                   size = 0;
+    vector<vector<unsigned> >  indices;
+  };
+  unordered_map<string, GlobalIndices> globalIndices;
+};
+
+// Members of a class found through reflection by anatools::getMember, keyed by
+// class and member name, so that each is only looked up once. A member is
+// either a function returning an arithmetic type, or is at a fixed offset
+// within the object.
+struct ReflectedMember
+{
+  string     type;                                        // e.g., "float"
+  void       (*function) (void *, int, void **, void *);  // NULL for a member at a fixed offset
+  ptrdiff_t  offset;
+};
+
+typedef map<string, map<string, ReflectedMember> > FunctionLookupTable;
+
 struct Collections
 {
   edm::Handle<osu::Beamspot>                beamspots;
@@ -162,6 +284,23 @@ struct Collections
   vector<edm::Handle<osu::Uservariable> >   uservariables;
   vector<edm::Handle<osu::Eventvariable> >  eventvariables;
 
+  // Flat view of the event variables from all of the eventvariables handles,
+  // indexed by anatools::getEventVariableIndex. It is filled at most once per
+  // event, by anatools::getMergedEventVariables, and is shared by every
+  // ValueLookupTree using these collections.
+  vector<double>                            mergedEventvariables;
+  bool                                      mergedEventvariablesAreFilled = false;
+
+  // Index tables for each composite collection, keyed by input label. They
+  // are built on first use by ValueLookupTree::getCombinationTable, marked as
+  // stale for each new event, and then refilled in place on first use.
+  unordered_map<string, CombinationTable>   combinationTables;
+
+  // Indices of the selected objects in each collection filtered by an
+  // ObjectSelector which does not copy the objects, keyed by collection name.
+  // Such a collection is only visited at these indices.
+  unordered_map<string, edm::Handle<vector<unsigned> > >  selectedIndices;
+
   edm::Handle<TYPE(triggers)>                 triggers;
   edm::Handle<vector<TYPE(trigobjs)> >        trigobjs;
   edm::Handle<TYPE(prescales)>                prescales;
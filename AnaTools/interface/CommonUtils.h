@@ -25,6 +25,7 @@
 #include "OSUT3Analysis/AnaTools/interface/MemberWithDict.h"
 #include "OSUT3Analysis/AnaTools/interface/TypeWithDict.h"
 
+#include "OSUT3Analysis/AnaTools/interface/AccessorTable.h"
 #include "OSUT3Analysis/AnaTools/interface/AnalysisTypes.h"
 
 struct Tokens
@@ -59,6 +60,40 @@ struct Tokens
 
   vector<edm::EDGetTokenT<osu::Uservariable> > uservariables;
   vector<edm::EDGetTokenT<osu::Eventvariable> > eventvariables;
+
+  unordered_map<string, edm::EDGetTokenT<vector<unsigned> > > selectedIndices;
+};
+
+// View of the objects in a collection which passed an ObjectSelector. If the
+// selector produced the indices of the selected objects rather than a copy of
+// them, only the objects at those indices are visited.
+template<class T> class SelectedObjects
+{
+  public:
+    class const_iterator
+    {
+      public:
+        const_iterator (const SelectedObjects<T> *view, unsigned i) : view_ (view), i_ (i) {}
+        const T &operator* () const { return view_->at (i_); }
+        const T *operator-> () const { return &view_->at (i_); }
+        const_iterator &operator++ () { i_++; return *this; }
+        bool operator!= (const const_iterator &other) const { return i_ != other.i_; }
+
+      private:
+        const SelectedObjects<T> *view_;
+        unsigned i_;
+    };
+
+    SelectedObjects (const vector<T> &objects, const vector<unsigned> * const indices = NULL) : objects_ (objects), indices_ (indices) {}
+
+    unsigned size () const { return (indices_ ? indices_->size () : objects_.size ()); }
+    const T &at (const unsigned i) const { return (indices_ ? objects_.at (indices_->at (i)) : objects_.at (i)); }
+    const_iterator begin () const { return const_iterator (this, 0); }
+    const_iterator end () const { return const_iterator (this, size ()); }
+
+  private:
+    const vector<T> &objects_;
+    const vector<unsigned> * const indices_;
 };
 
 namespace anatools
@@ -196,19 +231,39 @@ namespace anatools
   ////////////////////////////////////////////////////////////////////////////////
   bool firstOfTupleAscending (tuple<size_t, size_t, string>, tuple<size_t, size_t, string>);
   bool firstOfTupleDescending (tuple<size_t, size_t, string>, tuple<size_t, size_t, string>);
-  bool collectionIndexAscending (pair<string, DressedObject>, pair<string, DressedObject>);
   ////////////////////////////////////////////////////////////////////////////////
 
   // Retrieves all the collections from the event which are needed based on the
   // first argument.
   void getRequiredCollections (const unordered_set<string> &, Collections &, const edm::Event &, const Tokens &);
 
-  double getMember (const string &type, void *obj, const string &member, map<pair<string, string>, pair<string, void (*) (void *, int, void **, void *)> > * = NULL);
+  // Returns the index of the named event variable in the merged view of all
+  // event variables, registering the name if it has not been seen before.
+  unsigned getEventVariableIndex (const string &);
+
+  // Returns the merged view of all event variables in the current event,
+  // filling it from the eventvariables handles on the first call per event.
+  const vector<double> &getMergedEventVariables (Collections &);
+
+  // Packs a vector of flags into the bits of a FlagBits object.
+  void packFlags (const vector<bool> &, FlagBits &);
+
+  // Packs the object flags for the given collections into the compact form
+  // used in the CutCalculatorPayload, and unpacks them again.
+  void packObjectFlags (const FlagMap &, const vector<string> &, PackedFlagMap &);
+  void unpackObjectFlags (const PackedFlagMap &, const vector<string> &, FlagMap &);
+
+  // Retrieves the packed flags after the given cut for the collection with
+  // the given index out of the given number of collections. Returns false if
+  // there are no flags for this collection.
+  bool getObjectFlags (const PackedFlagMap &, const unsigned, const unsigned, const unsigned, vector<pair<bool, bool> > &);
+
+  double getMember (const string &type, void *obj, const string &member, FunctionLookupTable * = NULL);
 
   template <class T> double getMember (const T &obj, const string &member);
 
 #ifdef ROOT6
-  anatools::ObjectWithDict * getMember (const anatools::TypeWithDict &tDerived, const anatools::TypeWithDict &t, const anatools::ObjectWithDict &o, const string &member, string &memberType, map<pair<string, string>, pair<string, void (*) (void *, int, void **, void *)> > *);
+  anatools::ObjectWithDict * getMember (const anatools::TypeWithDict &tDerived, const anatools::TypeWithDict &t, const anatools::ObjectWithDict &o, const string &member, string &memberType, FunctionLookupTable *);
   anatools::ObjectWithDict * invoke (const string &returnType, const anatools::ObjectWithDict &o, const anatools::FunctionWithDict &f);
 #else
   const Reflex::Object * const getMember (const Reflex::Type &t, const Reflex::Object &o, const string &member, string &memberType);
@@ -219,6 +274,11 @@ namespace anatools
 
   void getAllTokens (const edm::ParameterSet &, edm::ConsumesCollector &&, Tokens &);
 
+  // Returns a view of the objects in the named collection which passed its
+  // ObjectSelector. The handles may be Collections or any other structure
+  // with a selectedIndices map of the same type.
+  template<class T, class H> SelectedObjects<T> selectedObjects (const edm::Handle<vector<T> > &, const H &, const string &);
+
   template<class T> bool jetPassesTightLepVeto (const T &);
 
   template<class T> bool isMatchedToTriggerObject (const edm::Event &, const edm::TriggerResults &, const T &, const vector<pat::TriggerObjectStandAlone> &, const string &, const string &, const double = 0.1);
@@ -246,6 +306,24 @@ anatools::getMember(const T &obj, const string &member)
   return getMember(type, (void *) &obj, member);
 }
 
+/**
+ * Returns a view of the objects in a collection which passed its
+ * ObjectSelector, without copying them.
+ *
+ * @param  collection handle to the collection
+ * @param  handles    structure containing the selected indices, if any
+ * @param  name       name of the collection, e.g., "muons"
+ * @return view of the selected objects
+ */
+template<class T, class H> SelectedObjects<T>
+anatools::selectedObjects (const edm::Handle<vector<T> > &collection, const H &handles, const string &name)
+{
+  auto indices = handles.selectedIndices.find (name);
+  if (indices != handles.selectedIndices.end () && indices->second.isValid ())
+    return SelectedObjects<T> (*collection, &(*indices->second));
+  return SelectedObjects<T> (*collection);
+}
+
 /**
  * Returns a hash value representing the given object.
  *
@@ -26,6 +26,7 @@
 #define INVALID_TYPE void *
 
 #define ORIGINAL_FORMAT "originalFormat"  // Must match definition used in processingUtilities.py
+#define SELECTED_INDICES "selectedIndices"  // Must match definition used in processingUtilities.py
 
 #if DATA_FORMAT == MINI_AOD
 
@@ -9,7 +9,16 @@
 #include "OSUT3Analysis/AnaTools/interface/AnalysisTypes.h"
 #include "OSUT3Analysis/AnaTools/interface/CommonUtils.h"
 
-
+// Base class for the modules which compute event-level variables.
+//
+// Derived classes which loop over an object collection must do so through
+// anatools::selectedObjects, never over the handle itself. When the channel is
+// added with selectByIndex, the collections given to these modules are not
+// filtered; the ObjectSelectors only produce the indices of the objects which
+// passed the cuts, and iterating over the handle would include the objects
+// which failed them. Derived classes which keep their own handles, instead of
+// using anatools::getAllTokens and anatools::getRequiredCollections, must call
+// getSelectedIndices when they get their collections.
 class EventVariableProducer : public edm::EDFilter
   {
     public:
@@ -27,6 +36,11 @@ class EventVariableProducer : public edm::EDFilter
       edm::ParameterSet collections_;
       unordered_set<string> objectsToGet_;
       unique_ptr<EventVariableProducerPayload> eventvariables;
+      unordered_map<string, edm::EDGetTokenT<vector<unsigned> > > selectedIndicesTokens_;
+
+      // Methods
+
+      void getSelectedIndices (const unordered_set<string> &, const edm::Event &, unordered_map<string, edm::Handle<vector<unsigned> > > &) const;
 
     private:
 
@@ -8,12 +8,18 @@
 #include "FWCore/Framework/interface/EDFilter.h"
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/EventSetup.h"
+#include "FWCore/Framework/interface/Run.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 
 #include "OSUT3Analysis/AnaTools/interface/CommonUtils.h"
 
 #define EXIT_CODE 2
 
+// Declaration of the ObjectSelector EDFilter which, for one collection, keeps
+// the objects passing all the cuts of a channel. The indices of the selected
+// objects are always produced. Copies of the selected objects, in the OSU
+// format and in the original format, are produced only if "copyObjects" and
+// "saveOriginalFormat", respectively, are true, which is the default.
 template<class T, class TO>
 class ObjectSelector : public edm::EDFilter
 {
@@ -21,6 +27,7 @@ class ObjectSelector : public edm::EDFilter
     ObjectSelector (const edm::ParameterSet &);
     ~ObjectSelector ();
 
+    void beginRun (const edm::Run &, const edm::EventSetup &);
     bool filter (edm::Event &, const edm::EventSetup &);
 
   private:
@@ -32,11 +39,22 @@ class ObjectSelector : public edm::EDFilter
     edm::InputTag      originalCollection_;
     edm::InputTag      cutDecisions_;
     bool               firstEvent_;
+    bool               copyObjects_;
+    bool               saveOriginalFormat_;
     ////////////////////////////////////////////////////////////////////////////
 
     // InputTag for the collection which is to be filtered.
     edm::InputTag            collection_;
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Position of the flags for the collection which is to be filtered in the
+    // cut decisions, taken from the cut schema of the current run.
+    ////////////////////////////////////////////////////////////////////////////
+    int       collectionIndex_;
+    unsigned  nCollections_;
+    unsigned  nCuts_;
+    ////////////////////////////////////////////////////////////////////////////
+
     ////////////////////////////////////////////////////////////////////////////
     // Objects which can be gotten from the event.
     ////////////////////////////////////////////////////////////////////////////
@@ -45,16 +63,19 @@ class ObjectSelector : public edm::EDFilter
     edm::Handle<T>                     singleton;
     edm::Handle<TO>                    singletonOrig;  // original format singleton
     edm::Handle<CutCalculatorPayload>  cutDecisions;
+    edm::Handle<CutSchema>             cutSchema;
     edm::EDGetTokenT<vector<T> >            collectionToken_;
     edm::EDGetTokenT<vector<TO> >           collectionOrigToken_;
     edm::EDGetTokenT<T>                     singletonToken_;
     edm::EDGetTokenT<TO>                    singletonOrigToken_;
     edm::EDGetTokenT<CutCalculatorPayload>  cutDecisionsToken_;
+    edm::EDGetTokenT<CutSchema>             cutSchemaToken_;
     ////////////////////////////////////////////////////////////////////////////
 
     // Payload for this EDFilter.
-    unique_ptr<vector<T> >  pl_;
-    unique_ptr<vector<TO> > plO_; // original format
+    unique_ptr<vector<T> >         pl_;
+    unique_ptr<vector<TO> >        plO_; // original format
+    unique_ptr<vector<unsigned> >  plI_; // indices of the selected objects
 };
 
 template<class T, class TO>
@@ -63,17 +84,27 @@ ObjectSelector<T, TO>::ObjectSelector (const edm::ParameterSet &cfg) :
   collectionToFilter_  (cfg.getParameter<string>             ("collectionToFilter")),
   originalCollection_  (cfg.getParameter<edm::InputTag>      ("originalCollection")),
   cutDecisions_        (cfg.getParameter<edm::InputTag>      ("cutDecisions")),
-  firstEvent_          (true)
+  firstEvent_          (true),
+  copyObjects_         (cfg.exists ("copyObjects") ? cfg.getParameter<bool> ("copyObjects") : true),
+  saveOriginalFormat_  (cfg.exists ("saveOriginalFormat") ? cfg.getParameter<bool> ("saveOriginalFormat") : true),
+  collectionIndex_     (-1),
+  nCollections_        (0),
+  nCuts_               (0)
 {
   // Retrieve the InputTag for the collection which is to be filtered.
   collection_ = collections_.getParameter<edm::InputTag> (collectionToFilter_);
 
-  produces<vector<T> >  (collection_.instance ());
-  produces<vector<TO> > (ORIGINAL_FORMAT);
+  produces<vector<unsigned> > (SELECTED_INDICES);
+  if (copyObjects_)
+    produces<vector<T> >  (collection_.instance ());
+  if (saveOriginalFormat_)
+    produces<vector<TO> > (ORIGINAL_FORMAT);
 
   collectionToken_ = consumes<vector<T> > (collection_);
-  collectionOrigToken_ = consumes<vector<TO> > (originalCollection_);
+  if (saveOriginalFormat_)
+    collectionOrigToken_ = consumes<vector<TO> > (originalCollection_);
   cutDecisionsToken_ = consumes<CutCalculatorPayload> (cutDecisions_);
+  cutSchemaToken_ = consumes<CutSchema, edm::InRun> (cutDecisions_);
 }
 
 template<class T, class TO>
@@ -81,6 +112,29 @@ template<class T, class TO>
 {
 }
 
+template<class T, class TO> void
+  ObjectSelector<T, TO>::beginRun (const edm::Run &run, const edm::EventSetup &setup)
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Find the flags for the collection which is to be filtered in the cut
+  // schema. If the collection is not in the schema, no objects are cut.
+  //////////////////////////////////////////////////////////////////////////////
+  collectionIndex_ = -1;
+  nCollections_ = nCuts_ = 0;
+  run.getByToken (cutSchemaToken_, cutSchema);
+  if (!cutSchema.isValid ())
+    {
+      clog << "WARNING: failed to retrieve cut schema from the run." << endl;
+      return;
+    }
+  nCollections_ = cutSchema->collections.size ();
+  nCuts_ = cutSchema->cutNames.size ();
+  auto collection = find (cutSchema->collections.begin (), cutSchema->collections.end (), collectionToFilter_);
+  if (collection != cutSchema->collections.end ())
+    collectionIndex_ = collection - cutSchema->collections.begin ();
+  //////////////////////////////////////////////////////////////////////////////
+}
+
 template<class T, class TO> bool
   ObjectSelector<T, TO>::filter (edm::Event &event, const edm::EventSetup &setup)
 {
@@ -89,11 +143,12 @@ template<class T, class TO> bool
   // there is a problem.
   //////////////////////////////////////////////////////////////////////////////
   event.getByToken (collectionToken_, collection);
-  event.getByToken (collectionOrigToken_, collectionOrig);
+  if (saveOriginalFormat_)
+    event.getByToken (collectionOrigToken_, collectionOrig);
   event.getByToken (cutDecisionsToken_, cutDecisions);
   if (firstEvent_ && !collection.isValid ())
     clog << "WARNING: failed to retrieve requested collection from the event." << endl;
-  if (firstEvent_ && !collectionOrig.isValid ())
+  if (firstEvent_ && saveOriginalFormat_ && !collectionOrig.isValid ())
     clog << "WARNING: failed to retrieve original collection from the event." << endl;
   if (firstEvent_ && !cutDecisions.isValid ())
     clog << "WARNING: failed to retrieve cut decisions from the event." << endl;
@@ -103,7 +158,7 @@ template<class T, class TO> bool
   // The OSU collection and the original collection should always be the same
   // size.
   //////////////////////////////////////////////////////////////////////////////
-  if (collection->size () != collectionOrig->size ())
+  if (saveOriginalFormat_ && collection->size () != collectionOrig->size ())
     {
       clog << "ERROR: original collection and OSU collection have different sizes." << endl;
       exit (EXIT_CODE);
@@ -111,41 +166,46 @@ template<class T, class TO> bool
   //////////////////////////////////////////////////////////////////////////////
 
   //////////////////////////////////////////////////////////////////////////////
-  // Fill the payload with the objects from the collection which pass all cuts.
-  // If the collection could not be retrieved, the payload remains empty. If the
-  // cut decisions could not be retrieved, no objects are cut.
+  // Fill the payload with the indices of the objects from the collection which
+  // pass all cuts, and with copies of them if requested. If the collection
+  // could not be retrieved, the payload remains empty. If the cut decisions
+  // could not be retrieved, no objects are cut.
   //////////////////////////////////////////////////////////////////////////////
   pl_  = unique_ptr<vector<T> >  (new vector<T>  ());
   plO_ = unique_ptr<vector<TO> > (new vector<TO> ());
-  if (collection.isValid () && collectionOrig.isValid())
+  plI_ = unique_ptr<vector<unsigned> > (new vector<unsigned> ());
+  if (collection.isValid () && (!saveOriginalFormat_ || collectionOrig.isValid ()))
     {
-      auto objOrig = collectionOrig->begin();
-      for (auto object = collection->begin (); object != collection->end (); object++, objOrig++)
+      // Only the cumulative flags after the last cut are needed.
+      vector<pair<bool, bool> > flags;
+      bool hasFlags = cutDecisions.isValid () && nCuts_ && collectionIndex_ >= 0
+                   && anatools::getObjectFlags (cutDecisions->cumulativeObjectFlags, nCollections_, nCuts_ - 1, collectionIndex_, flags);
+
+      for (unsigned iObject = 0; iObject != collection->size (); iObject++)
         {
-          unsigned iObject = object - collection->begin ();
           bool passes = true;
 
-          if (cutDecisions.isValid ())
-            {
-              for (int iCut = cutDecisions->cumulativeObjectFlags.size () - 1; iCut >= 0; iCut--)
-                {
-                  passes = (cutDecisions->cumulativeObjectFlags.at (iCut).at (collectionToFilter_).at (iObject).second ? cutDecisions->cumulativeObjectFlags.at (iCut).at (collectionToFilter_).at (iObject).first : false);
-                  break;
-                }
-            }
-          if (passes)
-            {
-              pl_ ->push_back (*object);
-              plO_->push_back (*objOrig);
-            }
+          if (hasFlags)
+            passes = (flags.at (iObject).second ? flags.at (iObject).first : false);
+          if (!passes)
+            continue;
+          plI_->push_back (iObject);
+          if (copyObjects_)
+            pl_->push_back (collection->at (iObject));
+          if (saveOriginalFormat_)
+            plO_->push_back (collectionOrig->at (iObject));
         }
     }
   //////////////////////////////////////////////////////////////////////////////
 
-  event.put (std::move (pl_),  collection_.instance ());
-  event.put (std::move (plO_), ORIGINAL_FORMAT);
+  event.put (std::move (plI_), SELECTED_INDICES);
+  if (copyObjects_)
+    event.put (std::move (pl_),  collection_.instance ());
+  if (saveOriginalFormat_)
+    event.put (std::move (plO_), ORIGINAL_FORMAT);
   pl_.reset ();
   plO_.reset ();
+  plI_.reset ();
   firstEvent_ = false;
 
   // Return the global decision for the event. If the cut decisions could not
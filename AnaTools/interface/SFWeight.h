@@ -164,6 +164,28 @@ class RecoMuonWeight
   };
 
 
+class GraphSFWeight
+// Class for looking up a scale factor given for several eras, each as a TGraphAsymmErrors, at once
+  {
+    public:
+      GraphSFWeight (const vector<TGraphAsymmErrors *> &graphs);
+      ~GraphSFWeight ();
+      unsigned nEras () const { return nEras_; };
+      // Returns the value and upper error of the scale factor of each era at x.
+      const vector<pair<double, double> > &at (const double &x) const;
+
+    private:
+      unsigned nEras_;
+      double binWidth_;       // width of every bin if the edges are uniform, 0 otherwise
+      vector<double> edges_;  // sorted union of the bin edges of all the eras
+
+      // Row 2i is for x exactly at edges_[i], row 2i + 1 for x strictly
+      // between edges_[i] and edges_[i + 1], and the last row for x outside
+      // of the edges.
+      vector<vector<pair<double, double> > > rows_;
+  };
+
+
 
 
 #endif
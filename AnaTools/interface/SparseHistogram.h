@@ -0,0 +1,50 @@
+#ifndef SPARSE_HISTOGRAM
+
+#define SPARSE_HISTOGRAM
+
+#include <unordered_map>
+#include <vector>
+
+#include "TAxis.h"
+#include "TH1.h"
+
+using namespace std;
+
+// Accumulates the fills of a TH2D or TH3D in a hash of only those bins which
+// are actually filled, so that a finely binned histogram which is sparsely
+// populated does not hold every bin in memory for the whole job. At the end of
+// the job, the contents are written into a dense histogram with the same axes,
+// which then has exactly the contents, errors, entries and statistics it would
+// have had if it had been filled directly.
+class SparseHistogram
+  {
+    public:
+      SparseHistogram (const TAxis &, const TAxis &);
+      SparseHistogram (const TAxis &, const TAxis &, const TAxis &);
+      ~SparseHistogram () {};
+
+      // The same bin numbering as TH1::FindBin and the same filling as
+      // TH2::Fill and TH3::Fill.
+      TAxis *GetXaxis () { return &axes_.at (0); };
+      TAxis *GetYaxis () { return &axes_.at (1); };
+      TAxis *GetZaxis () { return &axes_.at (2); };
+      int FindBin (const double, const double, const double z = 0.0) const;
+      void Fill (const double, const double, const double);
+      void Fill (const double, const double, const double, const double);
+
+      unsigned size () const { return bins_.size (); };
+      void fill (TH1 * const) const;
+
+    private:
+      vector<TAxis> axes_;
+
+      // sum of the weights and of the squared weights in each filled bin
+      unordered_map<int, pair<double, double> > bins_;
+
+      double entries_;
+      vector<double> stats_;  // as in TH1::GetStats
+
+      void fill (const vector<double> &, const double);
+  };
+
+#endif
@@ -19,13 +19,10 @@ This will create a tree with the following structure:
       /   \
     abs   2.5
      |
-    ( )
-     |
     eta
 
 The nodes "eta" and "2.5" in this tree are leaves, i.e., they have no branches.
-The nodes "<", "abs", and "( )" are not leaves, i.e., they have at least one
-branch.
+The nodes "<" and "abs" are not leaves, i.e., they have at least one branch.
 When the evaluate function is called, e.g., myvaltree.evalutate(muons.at(0)),
 each node of the tree will be evaluated recursively.  The nodes that are leaves
 return the value they correspond to; the nodes that are not leaves apply an operator
@@ -35,47 +32,25 @@ In this example, the evaluate function will always return 0 or 1.
 Another example is an expression, e.g., "2 * abs(eta)", represented as:
       *
     /   \
-   abs   2
-    |
-   ( )
-    |
-   eta
+   2    abs
+         |
+        eta
 In this case the evaluate function would return a continuous value.
 
-Note that the prunedParentheses function will convert this tree to:
-      *
-    /   \
-   abs   2
-    |
-   (eta)
+The expression is first split into tokens in a single pass and then parsed by
+precedence climbing, so parentheses and commas never appear in the tree: the
+arguments of a function become the branches of the function's node.
 
-For a complex string such as innerTrack.hitPattern_.numberOfValidPixelHits > 0, the tree will have the following structure:
-               <
-             /   \
-            .     0
-         /     \
-    innerTrack  .
-               / \
-    hitPattern_  numberOfValidPixelHits
-
-Right after the tree is built, this tree will get pruned by the pruneDots() function
-to be the following:
+For a complex string such as innerTrack.hitPattern_.numberOfValidPixelHits > 0,
+the chain of names separated by dots is a single leaf:
                                                   <
                                                 /   \
    innerTrack.hitPattern_.numberOfValidPixelHits     0
 
-Here is an example using commas:
-               <
-             /   \
-         invMass   0
-            |
-            ()
-            |
-            ,
-          /   \
-       muon   muon
+unless it starts with a collection, e.g., "muon.pt", in which case the
+collection and the rest of the chain are the branches of a "." node.
 
-This will be converted to the following, by the prunedCommas() and prunedParentheses() functions:
+Here is an example using commas, "invMass(muon, muon) < 0":
                <
              /   \
          invMass   0
@@ -84,8 +59,6 @@ This will be converted to the following, by the prunedCommas() and prunedParenth
 
 */
 
-typedef unordered_multimap<string, DressedObject> ObjMap;
-
 class ValueLookupTree
 {
   public:
@@ -109,6 +82,11 @@ class ValueLookupTree
     bool evaluationError () const;
     ////////////////////////////////////////////////////////////////////////////
 
+    // Returns the whole tree in prefix notation, e.g., "> (invMass (muon, muon), 60)"
+    // for "invMass (muon, muon) > 60", or an empty string if the tree has not
+    // been built.
+    string print () const;
+
     ////////////////////////////////////////////////////////////////////////////
     // Methods for inserting an expression into the tree and for evaluating the
     // expression.  The evaluate() function returns values for each of the
@@ -123,7 +101,8 @@ class ValueLookupTree
     // Methods for retrieving various information about a collection.
     ////////////////////////////////////////////////////////////////////////////
     unsigned getLocalIndex (unsigned globalIndex, unsigned collectionIndex) const;
-    set<unsigned> getGlobalIndices (unsigned localIndex, const string &singleObjectCollection, string inputLabel) const;
+    const vector<unsigned> &getGlobalIndices (unsigned localIndex, const string &singleObjectCollection, const string &inputLabel) const;
+    const CombinationTable &getCombinationTable (const string &inputLabel) const;
     unsigned getCollectionSize (const string &name) const;
     bool collectionIsFound (const string &name) const;
     ////////////////////////////////////////////////////////////////////////////
@@ -133,29 +112,48 @@ class ValueLookupTree
     void destroy (Node * const) const;
 
     ////////////////////////////////////////////////////////////////////////////
-    // Methods for removing commas and parentheses from a tree.
+    // A token of an expression, as produced by tokenize().
     ////////////////////////////////////////////////////////////////////////////
-    void pruneCommas (Node * const) const;
-    void pruneParentheses (Node * &) const;
-    void pruneParentheses_ (Node * const) const;
-    void pruneDots (Node * &) const;
-    void pruneDots_ (Node * const) const;
+    struct Token
+    {
+      enum Type {NUMBER, NAME, OPERATOR, LEFT_PARENTHESIS, RIGHT_PARENTHESIS, END};
+      Type type;
+      string value;
+    };
     ////////////////////////////////////////////////////////////////////////////
 
+    // Method for resolving any event variables in the tree to their indices in
+    // the merged event variables.
+    void resolveEventVariables (Node * const) const;
+
+    // Method for sizing the scratch space used by evaluate() for the current
+    // tree and input collections.
+    void prepareEvaluation ();
+    unsigned depth (const Node * const) const;
+
     ////////////////////////////////////////////////////////////////////////////
-    // Recursive methods for inserting an expression into the tree and then
-    // evaluating it.
+    // Methods for parsing an expression into a tree and then evaluating it.
+    // The parse*() methods advance the index into the tokens past whatever
+    // they consume and return NULL if the tokens do not form an expression.
     ////////////////////////////////////////////////////////////////////////////
-    Node *insert_ (const string &, Node * const) const;
-    Leaf evaluate_ (const Node * const, const ObjMap &);
+    Node *parse (const string &) const;
+    bool tokenize (const string &, vector<Token> &) const;
+    Node *parseExpression (const vector<Token> &, unsigned &, const int) const;
+    Node *parseUnary (const vector<Token> &, unsigned &) const;
+    Node *parsePrimary (const vector<Token> &, unsigned &) const;
+    Node *newNode (const string &, const vector<Node *> & = {}) const;
+    int binaryPrecedence (const string &) const;
+    bool isFunction (const string &) const;
+    Leaf evaluate_ (const Node * const, const unsigned);
     ////////////////////////////////////////////////////////////////////////////
 
     // Mainly for debugging:
     string printNode(Node* node) const;
     string printValue(Node* node) const;
+    string printTree (const Node * const) const;
 
     // Returns the result of an operator acting on its operands.
-    Leaf evaluateOperator (const string &op, const vector<Leaf> &operands, const ObjMap &objs);
+    Leaf evaluateOperator (const string &op, const vector<Leaf> &operands);
 
     ////////////////////////////////////////////////////////////////////////////
     // Methods for retrieving and deleting an object from a collection.
@@ -177,37 +175,27 @@ class ValueLookupTree
     bool isnumber (const string &, double &) const;
     ////////////////////////////////////////////////////////////////////////////
 
-    // Method which returns true if the parentheses are not balanced, i.e., if
-    // the number of left parentheses does not equal the number of right
-    // parentheses.
-    bool splitParentheses (string) const;
-
     ////////////////////////////////////////////////////////////////////////////
-    // Methods for finding the first instance within a string of any one of a
-    // vector of target strings.
+    // Methods for naming collections during evaluation. plural() returns the
+    // collection name for an object name, e.g., "muons" for "muon", in a
+    // buffer which is overwritten by the next call. collectionIndex() returns
+    // the index of the first input collection with the given object name, or
+    // the number of input collections if there is none.
     ////////////////////////////////////////////////////////////////////////////
-    pair<size_t, string> findFirstOf (const string &s, const vector<string> &targets, const vector<string> &vetoTargets, const size_t pos = 0) const;
-    pair<size_t, string> findLastOf (const string &s, const vector<string> &targets, const vector<string> &vetoTargets, const size_t pos = string::npos) const;
-    bool vetoMatch (const string &, const string &, const size_t, const vector<string> &) const;
+    const string &plural (const string &);
+    unsigned collectionIndex (const string &);
     ////////////////////////////////////////////////////////////////////////////
 
-    // To avoid double counting. For a given set of objects, returns true only
-    // if they are all unique and in a specific order.
-    bool isUniqueCase (const ObjMap &, const unordered_set<string> &) const;
+    // To avoid double counting. For the current objects, returns true only if
+    // they are all unique and in a specific order.
+    bool isUniqueCase () const;
 
     ////////////////////////////////////////////////////////////////////////////
-    // Methods for inserting different types of operators into the tree.
+    // Methods for retrieving values from objects. The collection is given by
+    // the index of its first entry in inputCollections_.
     ////////////////////////////////////////////////////////////////////////////
-    bool insertBinaryInfixOperator (const string &, Node * const, const vector<string> &, const vector<string> & = {}) const;
-    bool insertUnaryPrefixOperator (const string &, Node * const, const vector<string> &, const vector<string> & = {}) const;
-    bool insertDots (const string &, Node * const) const;
-    bool insertParentheses (const string &, Node * const) const;
-    ////////////////////////////////////////////////////////////////////////////
-
-    ////////////////////////////////////////////////////////////////////////////
-    // Methods for retrieving values from objects.
-    ////////////////////////////////////////////////////////////////////////////
-    double valueLookup (const string &collection, const ObjMap &objs, const string &variable, const bool iterateObj = true);
+    double valueLookup (const unsigned collection, const string &variable, const bool iterateObj = true);
+    double eventvariableLookup (const unsigned index) const;
     ////////////////////////////////////////////////////////////////////////////
 
     Node            *root_;
@@ -215,8 +203,6 @@ class ValueLookupTree
     bool            evaluationError_;
 
     Collections                                    *handles_;
-    unordered_map<string, ObjMap::const_iterator>  objIterators_;  // defined for each collection
-    unordered_map<string, bool>                    shouldIterate_; // defined for each collection
     vector<Leaf>                                   values_;
     vector<unsigned>                               collectionSizes_; // vector index corresponds to collection index
     vector<unsigned>                               nCombinations_;   // vector index corresponds to collection index
@@ -224,13 +210,26 @@ class ValueLookupTree
     // nCombinations[i] specifies the number of combinations that can be formed from objects
     // in collections i to N, where N is the number of collections
 
-    vector<void *> uservariablesToDelete_;
-    vector<void *> eventvariablesToDelete_;
+    ////////////////////////////////////////////////////////////////////////////
+    // Scratch space for evaluate(). It is sized when the tree is built and
+    // reused for every combination of objects in every event, so evaluating
+    // the tree does not allocate any memory once the buffers have grown to
+    // the largest event seen. All are indexed like inputCollections_, except
+    // for operands_, which holds the operands of the node being evaluated at
+    // each depth of the tree.
+    ////////////////////////////////////////////////////////////////////////////
+    vector<unsigned>                               firstIndices_;    // first input collection with the same name
+    vector<string>                                 collectionTypes_; // as returned by getCollectionType
+    vector<DressedObject>                          objs_;            // current object from each input collection
+    vector<unsigned>                               objIterators_;    // object used for each collection by valueLookup
+    vector<vector<Leaf> >                          operands_;
+    string                                         pluralName_;
+    ////////////////////////////////////////////////////////////////////////////
 
     const int                                      verbose_ = 0;  // verbosity levels:  0, 1, ...
     // Typically you want to use verbosity of 1 when running over a single event.
 
-    map<pair<string, string>, pair<string, void (*) (void *, int, void **, void *)> > functionLookupTable_;
+    FunctionLookupTable functionLookupTable_;
 
 };
 
@@ -0,0 +1,41 @@
+#ifndef WEIGHT_ACCUMULATOR
+
+#define WEIGHT_ACCUMULATOR
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "TH1D.h"
+
+using namespace std;
+
+// Accumulates the per-event sums and sums of squares of a fixed-length list of
+// weights, e.g., PDF members or scale and alpha_s variations, so that the
+// histogram they are destined for only needs to be touched once at the end of
+// the job.
+class WeightAccumulator
+  {
+    public:
+      WeightAccumulator () {};
+      WeightAccumulator (const unsigned);
+      ~WeightAccumulator () {};
+
+      void resize (const unsigned);
+      unsigned size () const { return sumOfWeights_.size (); };
+      double *buffer () { return buffer_.data (); };
+
+      void add (const double * const, const unsigned, const double);
+      void add (const double scale) { add (buffer_.data (), buffer_.size (), scale); };
+      void fill (TH1D * const, const int firstBin = 1) const;
+
+      const vector<double> &sumOfWeights () const { return sumOfWeights_; };
+      const vector<double> &sumOfSquaredWeights () const { return sumOfSquaredWeights_; };
+
+    private:
+      vector<double> buffer_;
+      vector<double> sumOfWeights_;
+      vector<double> sumOfSquaredWeights_;
+  };
+
+#endif
@@ -13,33 +13,67 @@
 
 CutCalculator::CutCalculator (const edm::ParameterSet &cfg) :
   collections_    (cfg.getParameter<edm::ParameterSet>  ("collections")),
-  cuts_           (cfg.getParameter<edm::ParameterSet>  ("cuts")),
-  triggersInMenu_ (true),
   firstEvent_     (true)
 {
+  usesResource ();
 
   //////////////////////////////////////////////////////////////////////////////
-  // Try to unpack the cuts ParameterSet and quit if there is a problem.
+  // Try to unpack the cuts ParameterSet, or that of each channel, and quit if
+  // there is a problem.
   //////////////////////////////////////////////////////////////////////////////
-  if (!unpackCuts ())
+  if (cfg.exists ("channels"))
     {
-      clog << "ERROR: failed to interpret cuts PSet. Quitting..." << endl;
-      exit (EXIT_CODE);
+      for (const auto &channelCuts : cfg.getParameter<edm::VParameterSet> ("channels"))
+        {
+          Channel channel;
+          // Underscores are not allowed in product instance labels.
+          channel.productLabel = channelCuts.getParameter<string> ("name");
+          channel.productLabel.erase (remove (channel.productLabel.begin (), channel.productLabel.end (), '_'), channel.productLabel.end ());
+          if (!unpackCuts (channelCuts, channel))
+            {
+              clog << "ERROR: failed to interpret cuts PSet for channel " << channel.productLabel << ". Quitting..." << endl;
+              exit (EXIT_CODE);
+            }
+          channels_.push_back (channel);
+        }
+    }
+  else
+    {
+      Channel channel;
+      channel.productLabel = "cutDecisions";
+      if (!unpackCuts (cfg.getParameter<edm::ParameterSet> ("cuts"), channel))
+        {
+          clog << "ERROR: failed to interpret cuts PSet. Quitting..." << endl;
+          exit (EXIT_CODE);
+        }
+      channels_.push_back (channel);
+    }
+  buildCutTrie ();
+  for (auto &channel : channels_)
+    {
+      fillCutSchema (channel);
+      for (const auto &filter : channel.unpackedTriggerFilters)
+        {
+          auto triggerFilterId = triggerFilterIds_.insert ({filter, triggerFilterIds_.size ()}).first;
+          channel.triggerFilterIds.push_back (triggerFilterId->second);
+        }
     }
+  triggerFiltersInEvent_.resize (triggerFilterIds_.size (), false);
   //////////////////////////////////////////////////////////////////////////////
 
-  triggerNamesPSetID_.reset ();
-  triggerIndices_.clear ();
-
   anatools::getAllTokens (collections_, consumesCollector (), tokens_);
 
-  produces<CutCalculatorPayload> ("cutDecisions");
+  for (const auto &channel : channels_)
+    {
+      produces<CutSchema, edm::InRun> (channel.productLabel);
+      produces<CutCalculatorPayload> (channel.productLabel);
+    }
 }
 
 CutCalculator::~CutCalculator ()
 {
 
-   for (auto &cut : unpackedCuts_)
+   for (auto &cut : uniqueCuts_)
      {
        if (cut.valueLookupTree)
          delete cut.valueLookupTree;
@@ -48,6 +82,13 @@ CutCalculator::~CutCalculator ()
      }
 }
 
+void
+CutCalculator::beginRunProduce (edm::Run &run, const edm::EventSetup &setup)
+{
+  for (const auto &channel : channels_)
+    run.put (unique_ptr<CutSchema> (new CutSchema (channel.schema)), channel.productLabel);
+}
+
 void
 CutCalculator::produce (edm::Event &event, const edm::EventSetup &setup)
 {
@@ -55,28 +96,99 @@ CutCalculator::produce (edm::Event &event, const edm::EventSetup &setup)
   //////////////////////////////////////////////////////////////////////////////
   // Set all the private variables in the ValueLookup object before using it,
   // and parse the cut strings in the unpacked cuts into ValueLookupTree
-  // objects.
+  // objects. Each channel's cuts share the trees of their nodes in the trie.
   //////////////////////////////////////////////////////////////////////////////
-  if (!initializeValueLookupForest (unpackedCuts_, &handles_))
+  if (!initializeValueLookupForest (uniqueCuts_, &handles_))
     {
       clog << "ERROR: failed to parse all cut strings. Quitting..." << endl;
       exit (EXIT_CODE);
     }
+  if (firstEvent_)
+    {
+      for (auto &channel : channels_)
+        {
+          for (unsigned cutIndex = 0; cutIndex != channel.unpackedCuts.size (); cutIndex++)
+            {
+              channel.unpackedCuts.at (cutIndex).valueLookupTree = uniqueCuts_.at (channel.cutNodes.at (cutIndex)).valueLookupTree;
+              channel.unpackedCuts.at (cutIndex).arbitrationTree = uniqueCuts_.at (channel.cutNodes.at (cutIndex)).arbitrationTree;
+            }
+        }
+    }
   //////////////////////////////////////////////////////////////////////////////
 
   //////////////////////////////////////////////////////////////////////////////
-  // Create the payload for this EDProducer and initialize some of its members.
+  // Create the payload for each channel, and a scratch payload in which the
+  // flags for each branch of the trie of cuts are calculated.
   //////////////////////////////////////////////////////////////////////////////
-  pl_ = unique_ptr<CutCalculatorPayload> (new CutCalculatorPayload);
+  vector<unique_ptr<CutFlags> > payloads;
+  for (unsigned channelIndex = 0; channelIndex != channels_.size (); channelIndex++)
+    payloads.emplace_back (new CutFlags ());
+  pl_ = unique_ptr<CutFlags> (new CutFlags ());
   pl_->isValid = true;
-  pl_->cuts = unpackedCuts_;
-  pl_->triggers = unpackedTriggers_;
-  pl_->triggersToVeto = unpackedTriggersToVeto_;
-  pl_->triggerFilters = unpackedTriggerFilters_;
-  pl_->triggersInMenu = unpackedTriggersInMenu_;
-  pl_->metFilters = unpackedMETFilters_;
   //////////////////////////////////////////////////////////////////////////////
 
+  // Visit the nodes of the trie depth first, setting flags for each object
+  // indicating whether it passed the cut of each node. The flags of each
+  // channel are copied into its payload at the node of its last cut.
+  for (unsigned rootCutNode = 0; pl_->isValid && rootCutNode != rootCutNodes_.size (); rootCutNode++)
+    pl_->isValid = evaluateCutNode (rootCutNodes_.at (rootCutNode), payloads);
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Quit if there was a problem setting the flags for any of the objects.
+  //////////////////////////////////////////////////////////////////////////////
+  if (!pl_->isValid)
+    {
+      clog << "ERROR: failed to set flags. Quitting..." <<  endl;
+      exit (EXIT_CODE);
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  // Find the required trigger filters among the trigger objects once for all
+  // of the channels.
+  indexTriggerFilters (event);
+
+  for (unsigned channelIndex = 0; channelIndex != channels_.size (); channelIndex++)
+    {
+      Channel &channel = channels_.at (channelIndex);
+
+      pl_ = std::move (payloads.at (channelIndex));
+      pl_->isValid = true;
+      pl_->cuts = channel.unpackedCuts;
+      pl_->triggers = channel.unpackedTriggers;
+      pl_->triggersToVeto = channel.unpackedTriggersToVeto;
+      pl_->triggerFilters = channel.unpackedTriggerFilters;
+      pl_->triggersInMenu = channel.unpackedTriggersInMenu;
+      pl_->metFilters = channel.unpackedMETFilters;
+
+      // Decide whether the event passes the triggers specified by the user and
+      // store the decision in the payload.
+      evaluateTriggers (event, channel);
+      evaluateTriggerFilters (channel);
+      evaluateMETFilters (event, channel);
+
+      // Decide whether the event passes each cut
+      // by counting the number of objects passing the cut
+      // also AND together cut and trigger decision
+      setEventFlags ();
+
+      event.put (packPayload (channel), channel.productLabel);
+    }
+  pl_.reset ();
+  firstEvent_ = false;
+}
+
+bool
+CutCalculator::evaluateCutNode (unsigned node, vector<unique_ptr<CutFlags> > &payloads) const
+{
+  const Cut &currentCut = uniqueCuts_.at (node);
+  const CutNode &cutNode = cutNodes_.at (node);
+  unsigned currentCutIndex = cutNode.depth;
+
+  // Discard any flags left over from a previously visited branch below the
+  // parent of this node.
+  pl_->individualObjectFlags.resize (currentCutIndex);
+  pl_->cumulativeObjectFlags.resize (currentCutIndex);
+
   // getListOfObjects
   // for each cut:
   //   setInputCollectionFlags
@@ -85,55 +197,59 @@ CutCalculator::produce (edm::Event &event, const edm::EventSetup &setup)
   //   propagateFromCompositeCollections
   //   setOtherCollectionsFlags
 
-  vector<string> listOfObjects = getListOfObjects(pl_->cuts);
+  // Sets the flags for the current cut only for the objects which are
+  // being cut on.
+  pl_->isValid = setInputCollectionFlags (currentCut, currentCutIndex);
 
-  // Loop over cuts to set flags for each object indicating whether it passed
-  // the cut.
-  for (unsigned currentCutIndex = 0; pl_->isValid && currentCutIndex != pl_->cuts.size (); currentCutIndex++)
-    {
-      Cut currentCut = pl_->cuts.at (currentCutIndex);
-
-      // Sets the flags for the current cut only for the objects which are
-      // being cut on.
-      pl_->isValid = setInputCollectionFlags (currentCut, currentCutIndex);
+  // If the cut has an arbitration parameter, adjust flags accordingly
+  pl_->isValid = arbitrateInputCollectionFlags (currentCut, currentCutIndex);
 
-      // If the cut has an arbitration parameter, adjust flags accordingly
-      pl_->isValid = arbitrateInputCollectionFlags (currentCut, currentCutIndex);
+  // Copy flags to any composite collections containing the inputCollection, e.g. muons -> muon-jets
+  pl_->isValid = propagateFromSingleCollections (currentCut, currentCutIndex, cutNode.listOfObjects);
 
-      // Copy flags to any composite collections containing the inputCollection, e.g. muons -> muon-jets
-      pl_->isValid = propagateFromSingleCollections (currentCut, currentCutIndex, listOfObjects);
+  // Copy flags to any component collections contained in the inputCollection, e.g. muon-jets -> muons, jets, muon-muons, etc.
+  pl_->isValid = propagateFromCompositeCollections (currentCut, currentCutIndex, cutNode.listOfObjects);
 
-      // Copy flags to any component collections contained in the inputCollection, e.g. muon-jets -> muons, jets, muon-muons, etc.
-      pl_->isValid = propagateFromCompositeCollections (currentCut, currentCutIndex, listOfObjects);
+  // Set flags for all collections unrelated to the cut equal to true
+  pl_->isValid = setOtherCollectionsFlags (currentCut, currentCutIndex, cutNode.listOfObjects);
 
-      // Set flags for all collections unrelated to the cut equal to true
-      pl_->isValid = setOtherCollectionsFlags (currentCut, currentCutIndex, listOfObjects);
-    }
+  if (!pl_->isValid)
+    return false;
 
   //////////////////////////////////////////////////////////////////////////////
-  // Quit if there was a problem setting the flags for any of the objects.
+  // Store the flags for the channels ending at this node, keeping only those
+  // for the objects each channel uses. With a single channel, this is the only
+  // leaf of the trie and the flags can simply be moved.
   //////////////////////////////////////////////////////////////////////////////
-  if (!pl_->isValid)
+  for (const auto &channelIndex : cutNode.channels)
     {
-      clog << "ERROR: failed to set flags. Quitting..." <<  endl;
-      exit (EXIT_CODE);
+      CutFlags &payload = *payloads.at (channelIndex);
+      if (channels_.size () == 1)
+        {
+          payload.individualObjectFlags = std::move (pl_->individualObjectFlags);
+          payload.cumulativeObjectFlags = std::move (pl_->cumulativeObjectFlags);
+          continue;
+        }
+      payload.individualObjectFlags.resize (currentCutIndex + 1);
+      payload.cumulativeObjectFlags.resize (currentCutIndex + 1);
+      for (unsigned cutIndex = 0; cutIndex <= currentCutIndex; cutIndex++)
+        {
+          for (const auto &object : channels_.at (channelIndex).listOfObjects)
+            {
+              payload.individualObjectFlags.at (cutIndex)[object] = pl_->individualObjectFlags.at (cutIndex).at (object);
+              payload.cumulativeObjectFlags.at (cutIndex)[object] = pl_->cumulativeObjectFlags.at (cutIndex).at (object);
+            }
+        }
     }
   //////////////////////////////////////////////////////////////////////////////
 
-  // Decide whether the event passes the triggers specified by the user and
-  // store the decision in the payload.
-  evaluateTriggers (event);
-  evaluateTriggerFilters (event);
-  evaluateMETFilters (event);
-
-  // Decide whether the event passes each cut
-  // by counting the number of objects passing the cut
-  // also AND together cut and trigger decision
-  setEventFlags ();
+  for (const auto &child : cutNode.children)
+    {
+      if (!evaluateCutNode (child, payloads))
+        return false;
+    }
 
-  event.put (std::move (pl_), "cutDecisions");
-  pl_.reset ();
-  firstEvent_ = false;
+  return true;
 }
 
 bool
@@ -265,10 +381,7 @@ CutCalculator::propagateFromSingleCollections (const Cut &currentCut, unsigned c
         continue;
 
       // determine total size of collection, since it's composed of multiple single objects
-      int totalSize = 1;
-      for (const auto &component : components){
-        totalSize *= currentCut.valueLookupTree->getCollectionSize (component);
-      }
+      int totalSize = currentCut.valueLookupTree->getCombinationTable (inputType).nCombinations;
 
       // by default all composite objects pass
       pl_->individualObjectFlags.at (currentCutIndex)[inputType] = vector<pair<bool, bool> > (totalSize, make_pair (true, true));
@@ -290,7 +403,7 @@ CutCalculator::propagateFromSingleCollections (const Cut &currentCut, unsigned c
         }
 
         // get the list of global indices for the composite collection containing the object in question
-        set<unsigned> globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, currentCut.inputLabel, inputType);
+        const vector<unsigned> &globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, currentCut.inputLabel, inputType);
         for (const auto &globalIndex : globalIndices){
           // set flags to false for any composite object containing the bad individual object
           pl_->individualObjectFlags.at(currentCutIndex).at(inputType).at(globalIndex).first = false;
@@ -353,7 +466,7 @@ CutCalculator::propagateFromCompositeCollections (const Cut &currentCut, unsigne
         cumulativeFlags.push_back(false);
 
         // get the list of global indices for the composite collection containing the object in question
-        set<unsigned> globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, currentCut.inputLabel);
+        const vector<unsigned> &globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, currentCut.inputLabel);
         for (const auto &globalIndex : globalIndices){
           // if we find a "true" flag for any composite object, set the individual object flag to true
           if (pl_->individualObjectFlags.at(currentCutIndex).at(currentCut.inputLabel).at(globalIndex).first){
@@ -380,7 +493,7 @@ CutCalculator::propagateFromCompositeCollections (const Cut &currentCut, unsigne
         cumulativeFlags.push_back(true);
 
         // get the list of global indices for the composite collection containing the object in question
-        set<unsigned> globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, currentCut.inputLabel);
+        const vector<unsigned> &globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, currentCut.inputLabel);
         for (const auto &globalIndex : globalIndices){
           // if we find a "false" flag for any composite object, set the individual object flag to false
           if (!pl_->individualObjectFlags.at(currentCutIndex).at(currentCut.inputLabel).at(globalIndex).first){
@@ -415,10 +528,7 @@ CutCalculator::propagateFromCompositeCollections (const Cut &currentCut, unsigne
 
 
       // determine total size of collection, since it's potentially composed of multiple single objects
-      int totalSize = 1;
-      for (const auto &component : components){
-        totalSize *= currentCut.valueLookupTree->getCollectionSize (component);
-      }
+      int totalSize = currentCut.valueLookupTree->getCombinationTable (inputType).nCombinations;
 
       //////////////////////////////////////////////////////////////////////////////////////////
       // set individual and cumulative flags seperately (since for vetoes they're not identical)
@@ -440,7 +550,7 @@ CutCalculator::propagateFromCompositeCollections (const Cut &currentCut, unsigne
         }
 
         // get the list of global indices containing the object in question
-        set<unsigned> globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, inputType);
+        const vector<unsigned> &globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, inputType);
         for (const auto &globalIndex : globalIndices){
           // set flags to true for any (potentially composite) object containing the good individual object
           pl_->individualObjectFlags.at(currentCutIndex).at(inputType).at(globalIndex).first = true;
@@ -470,7 +580,7 @@ CutCalculator::propagateFromCompositeCollections (const Cut &currentCut, unsigne
         }
 
         // get the list of global indices containing the object in question
-        set<unsigned> globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, inputType);
+        const vector<unsigned> &globalIndices = currentCut.valueLookupTree->getGlobalIndices (index, singleObject, inputType);
         for (const auto &globalIndex : globalIndices){
           // set flags to true for any (potentially composite) object containing the good cumulative object
           pl_->cumulativeObjectFlags.at(currentCutIndex).at(inputType).at(globalIndex).first = true;
@@ -509,11 +619,7 @@ CutCalculator::setOtherCollectionsFlags (const Cut &currentCut, unsigned current
          continue;
 
        // determine total size of collection, since it may be composed of multiple single objects
-       vector<string> singleObjects = anatools::getSingleObjects (inputType);
-       int totalSize = 1;
-       for (auto singleObject = singleObjects.begin (); singleObject != singleObjects.end (); singleObject++){
-         totalSize *= currentCut.valueLookupTree->getCollectionSize (*singleObject);
-       }
+       int totalSize = currentCut.valueLookupTree->getCombinationTable (inputType).nCombinations;
 
        // since these collections don't pertain to the current cut, they all pass by default
        pl_->individualObjectFlags.at (currentCutIndex)[inputType] = vector<pair<bool, bool> > (totalSize, make_pair (true, true));
@@ -540,44 +646,44 @@ CutCalculator::setOtherCollectionsFlags (const Cut &currentCut, unsigned current
 ////////////////////////////////////////////////////////////////////////////////
 
 bool
-CutCalculator::unpackCuts ()
+CutCalculator::unpackCuts (const edm::ParameterSet &channelCuts, Channel &channel)
 {
   //////////////////////////////////////////////////////////////////////////////
   // If triggers are given, retrieve them.
   //////////////////////////////////////////////////////////////////////////////
-  if (cuts_.exists ("triggers"))
+  if (channelCuts.exists ("triggers"))
     {
-      unpackedTriggers_ = cuts_.getParameter<vector<string> > ("triggers");
+      channel.unpackedTriggers = channelCuts.getParameter<vector<string> > ("triggers");
       objectsToGet_.insert ("triggers");
     }
   else
     clog << "WARNING: no triggers have been specified." << endl;
-  if (cuts_.exists ("triggersToVeto"))
+  if (channelCuts.exists ("triggersToVeto"))
     {
-      unpackedTriggersToVeto_ = cuts_.getParameter<vector<string> > ("triggersToVeto");
+      channel.unpackedTriggersToVeto = channelCuts.getParameter<vector<string> > ("triggersToVeto");
       objectsToGet_.insert ("triggers");
     }
-  if (cuts_.exists ("triggerFilters"))
+  if (channelCuts.exists ("triggerFilters"))
     {
-      unpackedTriggerFilters_ = cuts_.getParameter<vector<string> > ("triggerFilters");
+      channel.unpackedTriggerFilters = channelCuts.getParameter<vector<string> > ("triggerFilters");
       objectsToGet_.insert ("triggers");
       objectsToGet_.insert ("trigobjs");
     }
-  if (cuts_.exists ("triggersInMenu"))
+  if (channelCuts.exists ("triggersInMenu"))
     {
-      unpackedTriggersInMenu_ = cuts_.getParameter<vector<string> > ("triggersInMenu");
+      channel.unpackedTriggersInMenu = channelCuts.getParameter<vector<string> > ("triggersInMenu");
       objectsToGet_.insert ("triggers");
     }
-  if (cuts_.exists ("metFilters"))
+  if (channelCuts.exists ("metFilters"))
     {
-      unpackedMETFilters_ = cuts_.getParameter<vector<string> > ("metFilters");
+      channel.unpackedMETFilters = channelCuts.getParameter<vector<string> > ("metFilters");
       objectsToGet_.insert ("metFilters");
     }
   //////////////////////////////////////////////////////////////////////////////
 
   // Retrieve the cuts and clear the vector in which they will be stored after
   // parsing.
-  edm::VParameterSet cuts = cuts_.getParameter<edm::VParameterSet> ("cuts");
+  edm::VParameterSet cuts = channelCuts.getParameter<edm::VParameterSet> ("cuts");
 
   // Loop over the cuts, parsing each one and storing it in a vector.
   for (unsigned currentCut = 0; currentCut != cuts.size (); currentCut++)
@@ -657,7 +763,7 @@ CutCalculator::unpackCuts ()
       // initialize the valueLookupTree pointers to be NULL.
       tempCut.valueLookupTree = NULL;
       tempCut.arbitrationTree = NULL;
-      unpackedCuts_.push_back (tempCut);
+      channel.unpackedCuts.push_back (tempCut);
     }
 
   return true;
@@ -705,7 +811,7 @@ CutCalculator::splitString (const string &inputString) const
 }
 
 bool
-CutCalculator::evaluateTriggers (const edm::Event &event)
+CutCalculator::evaluateTriggers (const edm::Event &event, Channel &channel)
 {
   //////////////////////////////////////////////////////////////////////////////
   // Initialize the flags for each trigger which is required to pass, each
@@ -722,13 +828,13 @@ CutCalculator::evaluateTriggers (const edm::Event &event)
   if (handles_.triggers.isValid ())
     {
       const edm::TriggerNames &triggerNames = event.triggerNames (*handles_.triggers);
-      if (triggerNamesPSetID_ != triggerNames.parameterSetID ())
+      if (channel.triggerNamesPSetID != triggerNames.parameterSetID ())
         {
-          triggerIndices_.clear ();
-          triggerNamesPSetID_ = triggerNames.parameterSetID ();
-          triggersInMenu_ = true;
+          channel.triggerIndices.clear ();
+          channel.triggerNamesPSetID = triggerNames.parameterSetID ();
+          channel.triggersInMenu = true;
         }
-      if (triggerIndices_.empty ())
+      if (channel.triggerIndices.empty ())
         {
           for (unsigned i = 0; i < triggerNames.size (); i++)
             {
@@ -744,8 +850,8 @@ CutCalculator::evaluateTriggers (const edm::Event &event)
                 {
                   if (name.find (pl_->triggersToVeto.at (triggerIndex)) == 0)
                     {
-                      triggerIndices_[pl_->triggersToVeto.at (triggerIndex)];
-                      triggerIndices_.at (pl_->triggersToVeto.at (triggerIndex)).insert (i);
+                      channel.triggerIndices[pl_->triggersToVeto.at (triggerIndex)];
+                      channel.triggerIndices.at (pl_->triggersToVeto.at (triggerIndex)).insert (i);
                       vetoTriggerDecision = vetoTriggerDecision && !pass;
                       pl_->vetoTriggerFlags.at (triggerIndex) = pass;
                     }
@@ -761,8 +867,8 @@ CutCalculator::evaluateTriggers (const edm::Event &event)
                 {
                   if (name.find (pl_->triggers.at (triggerIndex)) == 0)
                     {
-                      triggerIndices_[pl_->triggers.at (triggerIndex)];
-                      triggerIndices_.at (pl_->triggers.at (triggerIndex)).insert (i);
+                      channel.triggerIndices[pl_->triggers.at (triggerIndex)];
+                      channel.triggerIndices.at (pl_->triggers.at (triggerIndex)).insert (i);
                       triggerDecision = triggerDecision || pass;
                       pl_->triggerFlags.at (triggerIndex) = pass;
                     }
@@ -786,9 +892,9 @@ CutCalculator::evaluateTriggers (const edm::Event &event)
         {
           for (unsigned triggerIndex = 0; triggerIndex != pl_->triggersToVeto.size (); triggerIndex++)
             {
-              if (!triggerIndices_.count (pl_->triggersToVeto.at (triggerIndex)))
+              if (!channel.triggerIndices.count (pl_->triggersToVeto.at (triggerIndex)))
                 continue;
-              for (const auto &i : triggerIndices_.at (pl_->triggersToVeto.at (triggerIndex)))
+              for (const auto &i : channel.triggerIndices.at (pl_->triggersToVeto.at (triggerIndex)))
                 {
                   bool pass = handles_.triggers->accept (i);
                   vetoTriggerDecision = vetoTriggerDecision && !pass;
@@ -797,9 +903,9 @@ CutCalculator::evaluateTriggers (const edm::Event &event)
             }
           for (unsigned triggerIndex = 0; triggerIndex != pl_->triggers.size (); triggerIndex++)
             {
-              if (!triggerIndices_.count (pl_->triggers.at (triggerIndex)))
+              if (!channel.triggerIndices.count (pl_->triggers.at (triggerIndex)))
                 continue;
-              for (const auto &i : triggerIndices_.at (pl_->triggers.at (triggerIndex)))
+              for (const auto &i : channel.triggerIndices.at (pl_->triggers.at (triggerIndex)))
                 {
                   bool pass = handles_.triggers->accept (i);
                   triggerDecision = triggerDecision || pass;
@@ -814,50 +920,68 @@ CutCalculator::evaluateTriggers (const edm::Event &event)
   // event to pass.
   //////////////////////////////////////////////////////////////////////////
   for (const auto &flag : pl_->triggerInMenuFlags)
-    triggersInMenu_ = triggersInMenu_ && flag;
+    channel.triggersInMenu = channel.triggersInMenu && flag;
   //////////////////////////////////////////////////////////////////////////
 
   // Store the logical AND of the three event-wide flags as the event-wide
   // trigger decision in the payload and return it.
-  return (pl_->triggerDecision = (triggerDecision && vetoTriggerDecision && triggersInMenu_));
+  return (pl_->triggerDecision = (triggerDecision && vetoTriggerDecision && channel.triggersInMenu));
+}
+
+void
+CutCalculator::indexTriggerFilters (const edm::Event &event)
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Flag each required trigger filter which is among the filter labels of any
+  // trigger object in the event. The trigger objects are unpacked and their
+  // filter labels looked up only once per event, however many channels and
+  // filters there are.
+  //////////////////////////////////////////////////////////////////////////////
+  triggerFiltersInEvent_.assign (triggerFiltersInEvent_.size (), false);
+  if (triggerFilterIds_.empty () || !handles_.triggers.isValid () || !handles_.trigobjs.isValid ())
+    return;
+
+#if DATA_FORMAT_FROM_MINIAOD
+  const edm::TriggerNames &triggerNames = event.triggerNames (*handles_.triggers);
+  unsigned nTriggerFiltersFound = 0;
+  for (const auto &packedTrigobj : *handles_.trigobjs)
+    {
+      pat::TriggerObjectStandAlone trigobj (packedTrigobj);
+      trigobj.unpackPathNames (triggerNames);
+      for (const auto &filter : trigobj.filterLabels ())
+        {
+          auto triggerFilterId = triggerFilterIds_.find (filter);
+          if (triggerFilterId == triggerFilterIds_.end () || triggerFiltersInEvent_.at (triggerFilterId->second))
+            continue;
+          triggerFiltersInEvent_.at (triggerFilterId->second) = true;
+          nTriggerFiltersFound++;
+        }
+
+      // Stop as soon as every required filter has been found.
+      if (nTriggerFiltersFound == triggerFiltersInEvent_.size ())
+        break;
+    }
+#endif
+  //////////////////////////////////////////////////////////////////////////////
 }
 
 bool
-CutCalculator::evaluateTriggerFilters (const edm::Event &event) const
+CutCalculator::evaluateTriggerFilters (const Channel &channel) const
 {
   bool triggerFilterDecision = pl_->triggerFilters.empty ();
   pl_->triggerFilterFlags.resize (pl_->triggerFilters.size (), false);
 
-  if (handles_.triggers.isValid () && handles_.trigobjs.isValid ())
+  for (unsigned i = 0; i < pl_->triggerFilters.size (); i++)
     {
-#if DATA_FORMAT_FROM_MINIAOD
-      const edm::TriggerNames &triggerNames = event.triggerNames (*handles_.triggers);
-#endif
-      for (unsigned i = 0; i < pl_->triggerFilters.size (); i++)
-        {
-#if DATA_FORMAT_FROM_MINIAOD
-          for (auto trigobj : *handles_.trigobjs)
-            {
-              trigobj.unpackPathNames (triggerNames);
-              for (const auto &filter : trigobj.filterLabels ())
-                {
-                  pl_->triggerFilterFlags.at (i) = (pl_->triggerFilters.at (i) == filter);
-                  if (pl_->triggerFilterFlags.at (i))
-                    break;
-                }
-              if (pl_->triggerFilterFlags.at (i))
-                break;
-            }
-#endif
-          triggerFilterDecision = triggerFilterDecision || pl_->triggerFilterFlags.at (i);
-        }
+      pl_->triggerFilterFlags.at (i) = triggerFiltersInEvent_.at (channel.triggerFilterIds.at (i));
+      triggerFilterDecision = triggerFilterDecision || pl_->triggerFilterFlags.at (i);
     }
 
   return (pl_->triggerFilterDecision = triggerFilterDecision);
 }
 
 bool
-CutCalculator::evaluateMETFilters (const edm::Event &event)
+CutCalculator::evaluateMETFilters (const edm::Event &event, Channel &channel)
 {
   // The MET filter decisions are stored in an edm::TriggerResults object (for
   // some reason). As such, this code is just a copypasta of the code in
@@ -870,12 +994,12 @@ CutCalculator::evaluateMETFilters (const edm::Event &event)
   if (handles_.metFilters.isValid ())
     {
       const edm::TriggerNames &metFilterNames = event.triggerNames (*handles_.metFilters);
-      if (metFilterNamesPSetID_ != metFilterNames.parameterSetID ())
+      if (channel.metFilterNamesPSetID != metFilterNames.parameterSetID ())
         {
-          metFilterIndices_.clear ();
-          metFilterNamesPSetID_ = metFilterNames.parameterSetID ();
+          channel.metFilterIndices.clear ();
+          channel.metFilterNamesPSetID = metFilterNames.parameterSetID ();
         }
-      if (metFilterIndices_.empty ())
+      if (channel.metFilterIndices.empty ())
         {
           for (unsigned i = 0; i < metFilterNames.size (); i++)
             {
@@ -886,8 +1010,8 @@ CutCalculator::evaluateMETFilters (const edm::Event &event)
                 {
                   if (name.find (pl_->metFilters.at (metFilterIndex)) == 0)
                     {
-                      metFilterIndices_[pl_->metFilters.at (metFilterIndex)];
-                      metFilterIndices_.at (pl_->metFilters.at (metFilterIndex)).insert (i);
+                      channel.metFilterIndices[pl_->metFilters.at (metFilterIndex)];
+                      channel.metFilterIndices.at (pl_->metFilters.at (metFilterIndex)).insert (i);
                       metFilterDecision = metFilterDecision && pass;
                       pl_->metFilterFlags.at (metFilterIndex) = pass;
                     }
@@ -898,9 +1022,9 @@ CutCalculator::evaluateMETFilters (const edm::Event &event)
         {
           for (unsigned metFilterIndex = 0; metFilterIndex != pl_->metFilters.size (); metFilterIndex++)
             {
-              if (!metFilterIndices_.count (pl_->metFilters.at (metFilterIndex)))
+              if (!channel.metFilterIndices.count (pl_->metFilters.at (metFilterIndex)))
                 continue;
-              for (const auto &i : metFilterIndices_.at (pl_->metFilters.at (metFilterIndex)))
+              for (const auto &i : channel.metFilterIndices.at (pl_->metFilters.at (metFilterIndex)))
                 {
                   bool pass = handles_.metFilters->accept (i);
                   metFilterDecision = metFilterDecision && pass;
@@ -1049,6 +1173,130 @@ CutCalculator::getListOfObjects (const Cuts &cuts)
 
 }
 
+void
+CutCalculator::fillCutSchema (Channel &channel) const
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Copy the names of the cuts, triggers and collections of the channel into
+  // its schema, in the same order as the flags in the payload.
+  //////////////////////////////////////////////////////////////////////////////
+  for (const auto &cut : channel.unpackedCuts)
+    {
+      channel.schema.cutNames.push_back (cut.name);
+      channel.schema.cutStrings.push_back (cut.cutString);
+      channel.schema.inputLabels.push_back (cut.inputLabel);
+    }
+  channel.schema.collections = channel.listOfObjects;
+  channel.schema.triggers = channel.unpackedTriggers;
+  channel.schema.triggersToVeto = channel.unpackedTriggersToVeto;
+  channel.schema.triggerFilters = channel.unpackedTriggerFilters;
+  channel.schema.triggersInMenu = channel.unpackedTriggersInMenu;
+  channel.schema.metFilters = channel.unpackedMETFilters;
+}
+
+unique_ptr<CutCalculatorPayload>
+CutCalculator::packPayload (const Channel &channel) const
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Pack the flags of the current channel into the payload which is put into
+  // the event. The names which index the flags are in the channel's schema.
+  //////////////////////////////////////////////////////////////////////////////
+  unique_ptr<CutCalculatorPayload> payload (new CutCalculatorPayload);
+  payload->cutDecision = pl_->cutDecision;
+  payload->cutsDecision = pl_->cutsDecision;
+  payload->eventDecision = pl_->eventDecision;
+  payload->isValid = pl_->isValid;
+  payload->triggerDecision = pl_->triggerDecision;
+  payload->triggerFilterDecision = pl_->triggerFilterDecision;
+  payload->metFilterDecision = pl_->metFilterDecision;
+
+  anatools::packObjectFlags (pl_->cumulativeObjectFlags, channel.schema.collections, payload->cumulativeObjectFlags);
+  anatools::packObjectFlags (pl_->individualObjectFlags, channel.schema.collections, payload->individualObjectFlags);
+  anatools::packFlags (pl_->cumulativeEventFlags, payload->cumulativeEventFlags);
+  anatools::packFlags (pl_->individualEventFlags, payload->individualEventFlags);
+  anatools::packFlags (pl_->triggerFlags, payload->triggerFlags);
+  anatools::packFlags (pl_->vetoTriggerFlags, payload->vetoTriggerFlags);
+  anatools::packFlags (pl_->triggerFilterFlags, payload->triggerFilterFlags);
+  anatools::packFlags (pl_->triggerInMenuFlags, payload->triggerInMenuFlags);
+  anatools::packFlags (pl_->metFilterFlags, payload->metFilterFlags);
+  //////////////////////////////////////////////////////////////////////////////
+
+  return payload;
+}
+
+void
+CutCalculator::buildCutTrie ()
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Insert the sequence of cuts of each channel into the trie. A cut shares
+  // the node of an identical cut at the same position in another channel
+  // only if all the preceding cuts are shared as well, since the cumulative
+  // flags depend on them.
+  //////////////////////////////////////////////////////////////////////////////
+  for (unsigned channelIndex = 0; channelIndex != channels_.size (); channelIndex++)
+    {
+      Channel &channel = channels_.at (channelIndex);
+      channel.listOfObjects = getListOfObjects (channel.unpackedCuts);
+
+      int parent = -1;
+      for (unsigned cutIndex = 0; cutIndex != channel.unpackedCuts.size (); cutIndex++)
+        {
+          const Cut &cut = channel.unpackedCuts.at (cutIndex);
+          const vector<unsigned> &siblings = (parent < 0 ? rootCutNodes_ : cutNodes_.at (parent).children);
+
+          int node = -1;
+          for (const auto &sibling : siblings)
+            {
+              if (isSameCut (uniqueCuts_.at (sibling), cut))
+                {
+                  node = sibling;
+                  break;
+                }
+            }
+          if (node < 0)
+            {
+              node = cutNodes_.size ();
+
+              CutNode cutNode;
+              cutNode.depth = cutIndex;
+              cutNodes_.push_back (cutNode);
+              uniqueCuts_.push_back (cut);
+              (parent < 0 ? rootCutNodes_ : cutNodes_.at (parent).children).push_back (node);
+            }
+
+          // The node must set flags for every object used by any channel
+          // passing through it.
+          for (const auto &object : channel.listOfObjects)
+            {
+              if (find (cutNodes_.at (node).listOfObjects.begin (), cutNodes_.at (node).listOfObjects.end (), object) == cutNodes_.at (node).listOfObjects.end ())
+                cutNodes_.at (node).listOfObjects.push_back (object);
+            }
+
+          channel.cutNodes.push_back (node);
+          parent = node;
+        }
+      if (parent >= 0)
+        cutNodes_.at (parent).channels.push_back (channelIndex);
+    }
+  //////////////////////////////////////////////////////////////////////////////
+}
+
+bool
+CutCalculator::isSameCut (const Cut &a, const Cut &b) const
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Two cuts are the same if they set the same flags. The name is only used
+  // for display, so it may differ.
+  //////////////////////////////////////////////////////////////////////////////
+  return (a.inputLabel                ==  b.inputLabel
+       && a.cutString                 ==  b.cutString
+       && a.numberRequired            ==  b.numberRequired
+       && a.eventComparativeOperator  ==  b.eventComparativeOperator
+       && a.isVeto                    ==  b.isVeto
+       && a.arbitration               ==  b.arbitration);
+  //////////////////////////////////////////////////////////////////////////////
+}
+
 bool
   CutCalculator::isUniqueCase (const Cut &currentCut, unsigned globalIndex, string inputType) const
 {
@@ -1083,53 +1331,22 @@ bool
 
   ////////////////////////////////////////////////////////////////////////////////
 
-  vector<string> singleObjects = anatools::getSingleObjects (inputType);
-  // always unique for single object collections
-  if (singleObjects.size() <= 1){
-    return true;
-  }
-
-  vector<string> uniqueSingleObjects;
-  for (const auto &singleObject : singleObjects){
-    if (find(uniqueSingleObjects.begin(), uniqueSingleObjects.end(), singleObject) == uniqueSingleObjects.end())
-      uniqueSingleObjects.push_back(singleObject);
+  // The single object collections in the table are sorted, so any collection
+  // which is used more than once occupies adjacent positions, and it suffices
+  // to compare the local indices of neighbors. The local indices are computed
+  // with the same strides used by ValueLookupTree to build the combinations.
+  const CombinationTable &table = currentCut.valueLookupTree->getCombinationTable (inputType);
+  for (unsigned collectionIndex = 1; collectionIndex < table.singleObjects.size (); collectionIndex++){
+    if (table.singleObjects.at (collectionIndex) != table.singleObjects.at (collectionIndex - 1))
+      continue;
+    unsigned localIndex = (globalIndex / table.strides.at (collectionIndex)) % table.collectionSizes.at (collectionIndex),
+             prevIndex = (globalIndex / table.strides.at (collectionIndex - 1)) % table.collectionSizes.at (collectionIndex - 1);
+
+    // unique only as long as the objects are in order
+    if (localIndex <= prevIndex)
+      return false;
   }
-  // always unique if no collection is used more than once
-  if (singleObjects.size() == uniqueSingleObjects.size()){
-    return true;
-  }
-
-  // for each single input object, store the type and the local index of the object used
-  vector<pair<string,unsigned> > objectIndexMap;
-
-  int nCombinations = 1;
-  for (unsigned collectionIndex = 0; collectionIndex != singleObjects.size(); collectionIndex++){
-    unsigned localIndex;
-    int collectionSize = currentCut.valueLookupTree->getCollectionSize (singleObjects.at(collectionIndex));
-    if (collectionIndex + 1 != singleObjects.size ()){
-      nCombinations *= currentCut.valueLookupTree->getCollectionSize (singleObjects.at(collectionIndex));
-      localIndex = ((globalIndex / nCombinations) % currentCut.valueLookupTree->getCollectionSize (singleObjects.at(collectionIndex)));
-    }
-    else{
-      localIndex = (globalIndex % collectionSize);
-    }
-    objectIndexMap.emplace_back(singleObjects.at(collectionIndex),localIndex);
-  }
-
-  bool pass = true;
-  for (const auto &singleObject : uniqueSingleObjects){
-    int prevIndex = -1;
-    for (const auto &objectIndex : objectIndexMap){
-
-      if (objectIndex.first != singleObject)
-        continue;
-
-      // pass remains true as long as the objects are in order
-      pass = pass && ((int) objectIndex.second > prevIndex);
-      prevIndex = objectIndex.second;
-    }
-  }
-  return pass;
+  return true;
 }
 
 
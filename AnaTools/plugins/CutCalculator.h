@@ -3,24 +3,77 @@
 
 #include <unordered_set>
 
-#include "FWCore/Framework/interface/EDProducer.h"
+#include "FWCore/Framework/interface/one/EDProducer.h"
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/EventSetup.h"
+#include "FWCore/Framework/interface/Run.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 
 #include "OSUT3Analysis/AnaTools/interface/AnalysisTypes.h"
 
 // Declaration of the CutCalculator EDProducer which produces various flags
 // indicating whether the event and each object passed the user-defined cuts.
-class CutCalculator : public edm::EDProducer
+//
+// Given a "channels" VPSet instead of a single "cuts" PSet, one payload is
+// produced per channel, labeled by the channel name. The cuts of all channels
+// are then arranged in a trie, so that leading cuts which are identical across
+// channels are only evaluated once per event.
+//
+// The names of the cuts and triggers of each channel are put into each run as
+// a CutSchema, so that the per-event payload only holds the flags themselves.
+//
+// The cuts are evaluated through ValueLookupTree, which calls into ROOT
+// reflection and shared static state, so the module declares the legacy shared
+// resource and is serialized with the other modules that do the same.
+class CutCalculator : public edm::one::EDProducer<edm::one::SharedResources, edm::BeginRunProducer>
 {
   public:
     CutCalculator (const edm::ParameterSet &);
     ~CutCalculator ();
 
+    void beginRunProduce (edm::Run &, const edm::EventSetup &);
     void produce (edm::Event &, const edm::EventSetup &);
 
   private:
+    ////////////////////////////////////////////////////////////////////////////
+    // The unpacked cuts and triggers of a channel, and the bookkeeping for its
+    // trigger and MET filter decisions.
+    ////////////////////////////////////////////////////////////////////////////
+    struct Channel
+    {
+      string            productLabel;
+      Cuts              unpackedCuts;
+      vector<unsigned>  cutNodes;       // node in cutNodes_ for each cut
+      vector<string>    listOfObjects;
+      vector<string>    unpackedTriggersToVeto;
+      vector<string>    unpackedTriggers;
+      vector<string>    unpackedTriggerFilters;
+      vector<unsigned>  triggerFilterIds;   // index in triggerFiltersInEvent_ for each filter
+      vector<string>    unpackedTriggersInMenu;
+      vector<string>    unpackedMETFilters;
+      CutSchema         schema;
+
+      bool triggersInMenu = true;
+      edm::ParameterSetID triggerNamesPSetID;
+      unordered_map<string, unordered_set<unsigned> > triggerIndices;
+
+      edm::ParameterSetID metFilterNamesPSetID;
+      unordered_map<string, unordered_set<unsigned> > metFilterIndices;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A node in the trie of cuts. The cut itself is stored at the same index
+    // in uniqueCuts_. Each node sets flags for the union of the objects used
+    // by the channels passing through it.
+    ////////////////////////////////////////////////////////////////////////////
+    struct CutNode
+    {
+      unsigned          depth;
+      vector<unsigned>  children;
+      vector<string>    listOfObjects;
+      vector<unsigned>  channels;       // channels whose last cut is this node
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     // Private methods used in calculating the cut decisions.
     ////////////////////////////////////////////////////////////////////////////
@@ -31,14 +84,20 @@ class CutCalculator : public edm::EDProducer
     bool setOtherCollectionsFlags (const Cut &, unsigned, const vector<string> &) const;
     bool propagateFromSingleCollections (const Cut &, unsigned, const vector<string> &) const;
     bool propagateFromCompositeCollections (const Cut &, unsigned, const vector<string> &) const;
-    bool unpackCuts ();
+    bool unpackCuts (const edm::ParameterSet &, Channel &);
+    void buildCutTrie ();
+    bool isSameCut (const Cut &, const Cut &) const;
+    bool evaluateCutNode (unsigned, vector<unique_ptr<CutFlags> > &) const;
     bool evaluateComparison (int, const string &, int) const;
     vector<string> splitString (const string &) const;
-    bool evaluateTriggers (const edm::Event &);
-    bool evaluateTriggerFilters (const edm::Event &) const;
-    bool evaluateMETFilters (const edm::Event &);
+    bool evaluateTriggers (const edm::Event &, Channel &);
+    void indexTriggerFilters (const edm::Event &);
+    bool evaluateTriggerFilters (const Channel &) const;
+    bool evaluateMETFilters (const edm::Event &, Channel &);
     bool setEventFlags () const;
     vector<string> getListOfObjects (const Cuts &);
+    void fillCutSchema (Channel &) const;
+    unique_ptr<CutCalculatorPayload> packPayload (const Channel &) const;
     bool isUniqueCase (const Cut &, unsigned, string) const;
 
     ////////////////////////////////////////////////////////////////////////////
@@ -47,35 +106,33 @@ class CutCalculator : public edm::EDProducer
     // Private variables initialized by the constructor.
     ////////////////////////////////////////////////////////////////////////////
     edm::ParameterSet  collections_;
-    edm::ParameterSet  cuts_;
-    bool               triggersInMenu_;
     bool               firstEvent_;
     ////////////////////////////////////////////////////////////////////////////
 
     ////////////////////////////////////////////////////////////////////////////
-    // Private variables set after unpacking the cuts ParameterSet.
+    // Private variables set after unpacking the cuts ParameterSet(s).
     ////////////////////////////////////////////////////////////////////////////
     unordered_set<string>  objectsToGet_;
-    Cuts                   unpackedCuts_;
-    vector<string>         unpackedTriggersToVeto_;
-    vector<string>         unpackedTriggers_;
-    vector<string>         unpackedTriggerFilters_;
-    vector<string>         unpackedTriggersInMenu_;
-    vector<string>         unpackedMETFilters_;
+    vector<Channel>        channels_;
+    Cuts                   uniqueCuts_;
+    vector<CutNode>        cutNodes_;
+    vector<unsigned>       rootCutNodes_;
+
+    // Ids of the trigger filters required by any of the channels, and whether
+    // each filter label is found among the trigger objects of the current
+    // event.
+    unordered_map<string, unsigned>  triggerFilterIds_;
+    vector<bool>                     triggerFiltersInEvent_;
     ////////////////////////////////////////////////////////////////////////////
 
-    edm::ParameterSetID triggerNamesPSetID_;
-    unordered_map<string, unordered_set<unsigned> > triggerIndices_;
-
-    edm::ParameterSetID metFilterNamesPSetID_;
-    unordered_map<string, unordered_set<unsigned> > metFilterIndices_;
-
     // Object collections which can be gotten from the event.
     Collections handles_;
     Tokens tokens_;
 
-    // Payload for this EDProducer.
-    unique_ptr<CutCalculatorPayload>  pl_;
+    // Flags for the current channel, which are packed into the payload for
+    // this EDProducer. While the trie of cuts is evaluated, they are the flags
+    // for the current branch.
+    unique_ptr<CutFlags>  pl_;
 
     // Function for initializing the ValueLookupTree objects, one for each cut.
     bool initializeValueLookupForest (Cuts &, Collections * const);
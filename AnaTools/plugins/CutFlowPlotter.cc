@@ -27,6 +27,7 @@ CutFlowPlotter::CutFlowPlotter (const edm::ParameterSet &cfg) :
   //////////////////////////////////////////////////////////////////////////////
 
   cutDecisionsToken_ = consumes<CutCalculatorPayload> (cutDecisions_);
+  cutSchemaToken_ = consumes<CutSchema, edm::InRun> (cutDecisions_);
   if (collections_.exists ("generatorweights"))
     generatorweightsToken_ = consumes<TYPE(generatorweights)> (collections_.getParameter<edm::InputTag> ("generatorweights"));
 }
@@ -77,28 +78,28 @@ CutFlowPlotter::~CutFlowPlotter ()
          << endl;
 
     if(name.Contains("trigger filter")) {
-      for(uint j = 0; j < triggerFilters_.size(); j++) {
-        clog << " " << triggerFilters_.at(j);
-        if(j < triggerFilters_.size() - 1) clog << " OR";
+      for(uint j = 0; j < cutSchema_.triggerFilters.size(); j++) {
+        clog << " " << cutSchema_.triggerFilters.at(j);
+        if(j < cutSchema_.triggerFilters.size() - 1) clog << " OR";
         clog << endl;
       }
     }
 
     else if(name.Contains("trigger")) {
-      for(uint j = 0; j < triggers_.size(); j++) {
-        clog << "  " << triggers_.at(j);
-        if(j < triggers_.size() - 1) clog << " OR";  // all but the last one
+      for(uint j = 0; j < cutSchema_.triggers.size(); j++) {
+        clog << "  " << cutSchema_.triggers.at(j);
+        if(j < cutSchema_.triggers.size() - 1) clog << " OR";  // all but the last one
         clog << endl;
       }
-      for(uint j = 0; j < triggersToVeto_.size(); j++) {
-        clog << "  AND NOT " << triggersToVeto_.at(j) << endl;
+      for(uint j = 0; j < cutSchema_.triggersToVeto.size(); j++) {
+        clog << "  AND NOT " << cutSchema_.triggersToVeto.at(j) << endl;
       }
     }
 
     else if(name.Contains("MET filter")) {
-      for(uint j = 0; j < metFilters_.size(); j++) {
-        clog << " " << metFilters_.at(j);
-        if(j < metFilters_.size() - 1) clog << " AND";
+      for(uint j = 0; j < cutSchema_.metFilters.size(); j++) {
+        clog << " " << cutSchema_.metFilters.at(j);
+        if(j < cutSchema_.metFilters.size() - 1) clog << " AND";
         clog << endl;
       }
     }
@@ -107,6 +108,21 @@ CutFlowPlotter::~CutFlowPlotter ()
 
 }
 
+void
+CutFlowPlotter::beginRun (const edm::Run &run, const edm::EventSetup &setup)
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Copy the names of the cuts and triggers from the run, printing a warning
+  // if there is a problem. They are the same for every run of a job.
+  //////////////////////////////////////////////////////////////////////////////
+  run.getByToken (cutSchemaToken_, cutSchema);
+  if (cutSchema.isValid ())
+    cutSchema_ = *cutSchema;
+  else
+    clog << "WARNING: failed to retrieve cut schema from the run." << endl;
+  //////////////////////////////////////////////////////////////////////////////
+}
+
 void
 CutFlowPlotter::analyze (const edm::Event &event, const edm::EventSetup &setup)
 {
@@ -155,10 +171,10 @@ CutFlowPlotter::initializeCutFlow ()
   // If triggers have been specified, add a special bin for the trigger
   // decision.
   //////////////////////////////////////////////////////////////////////////////
-  unsigned nCuts = cutDecisions->cuts.size ();
-  !cutDecisions->triggers.empty () && nCuts++;
-  !cutDecisions->triggerFilters.empty () && nCuts++;
-  !cutDecisions->metFilters.empty () && nCuts++;
+  unsigned nCuts = cutSchema_.cutNames.size ();
+  !cutSchema_.triggers.empty () && nCuts++;
+  !cutSchema_.triggerFilters.empty () && nCuts++;
+  !cutSchema_.metFilters.empty () && nCuts++;
   oneDHists_.at ("cutFlow")->SetBins    (nCuts + 1,  0.0,  nCuts + 1);
   oneDHists_.at ("selection")->SetBins  (nCuts + 1,  0.0,  nCuts + 1);
   //  oneDHists_.at ("minusOne")->SetBins   (nCuts + 1,  0.0,  nCuts + 1);
@@ -168,47 +184,35 @@ CutFlowPlotter::initializeCutFlow ()
   // Set the bin labels for the rest of the bins according to the name of the
   // cut. The special bin for the trigger decision is simply labeled "trigger".
   //////////////////////////////////////////////////////////////////////////////
-  if (!cutDecisions->triggers.empty ())
+  if (!cutSchema_.triggers.empty ())
     {
       oneDHists_.at ("cutFlow")->GetXaxis    ()->SetBinLabel  (bin,  "trigger");
       oneDHists_.at ("selection")->GetXaxis  ()->SetBinLabel  (bin,  "trigger");
       //      oneDHists_.at ("minusOne")->GetXaxis   ()->SetBinLabel  (bin,  "trigger");
       bin++;
     }
-  if (!cutDecisions->triggerFilters.empty ())
+  if (!cutSchema_.triggerFilters.empty ())
     {
       oneDHists_.at ("cutFlow")->GetXaxis    ()->SetBinLabel  (bin,  "trigger filter");
       oneDHists_.at ("selection")->GetXaxis  ()->SetBinLabel  (bin,  "trigger filter");
       //      oneDHists_.at ("minusOne")->GetXaxis   ()->SetBinLabel  (bin,  "trigger filter");
       bin++;
     }
-  if (!cutDecisions->metFilters.empty ())
+  if (!cutSchema_.metFilters.empty ())
     {
       oneDHists_.at ("cutFlow")->GetXaxis    ()->SetBinLabel  (bin,  "MET filter");
       oneDHists_.at ("selection")->GetXaxis  ()->SetBinLabel  (bin,  "MET filter");
       //      oneDHists_.at ("minusOne")->GetXaxis   ()->SetBinLabel  (bin,  "trigger filter");
       bin++;
     }
-  for (vector<Cut>::const_iterator cut = cutDecisions->cuts.begin (); cut != cutDecisions->cuts.end (); cut++, bin++)
+  for (vector<string>::const_iterator cutName = cutSchema_.cutNames.begin (); cutName != cutSchema_.cutNames.end (); cutName++, bin++)
     {
-      oneDHists_.at ("cutFlow")->GetXaxis    ()->SetBinLabel  (bin,  cut->name.c_str  ());
-      oneDHists_.at ("selection")->GetXaxis  ()->SetBinLabel  (bin,  cut->name.c_str  ());
-      //      oneDHists_.at ("minusOne")->GetXaxis   ()->SetBinLabel  (bin,  cut->name.c_str  ());
+      oneDHists_.at ("cutFlow")->GetXaxis    ()->SetBinLabel  (bin,  cutName->c_str  ());
+      oneDHists_.at ("selection")->GetXaxis  ()->SetBinLabel  (bin,  cutName->c_str  ());
+      //      oneDHists_.at ("minusOne")->GetXaxis   ()->SetBinLabel  (bin,  cutName->c_str  ());
     }
   //////////////////////////////////////////////////////////////////////////////
 
-
-  //////////////////////////////////////////////////////////////////////////////
-  // Save in triggers_ a private copy of the list of triggers (which is the same for every event).
-  // This is needed because the CutCalculatorPayload object is not available in the
-  // destructor, when the terminal output is produced.
-  //////////////////////////////////////////////////////////////////////////////
-  triggers_ = cutDecisions->triggers;
-  triggersToVeto_ = cutDecisions->triggersToVeto;
-  triggerFilters_ = cutDecisions->triggerFilters;
-  metFilters_ = cutDecisions->metFilters;
-  //////////////////////////////////////////////////////////////////////////////
-
   // Return true if the initialization was successful.
   return true;
 }
@@ -235,7 +239,7 @@ CutFlowPlotter::fillCutFlow (double w)
   // Fill the rest of the bins according to the flags in the cut decisions
   // object.
   //////////////////////////////////////////////////////////////////////////////
-  if (!cutDecisions->triggers.empty ())
+  if (!cutSchema_.triggers.empty ())
     {
       passes = passes && cutDecisions->triggerDecision;
       if (cutDecisions->triggerDecision)
@@ -244,7 +248,7 @@ CutFlowPlotter::fillCutFlow (double w)
         oneDHists_.at ("cutFlow")->Fill    (bin,  w);
       bin++;
     }
-  if (!cutDecisions->triggerFilters.empty ())
+  if (!cutSchema_.triggerFilters.empty ())
     {
       passes = passes && cutDecisions->triggerFilterDecision;
       if (cutDecisions->triggerFilterDecision)
@@ -253,7 +257,7 @@ CutFlowPlotter::fillCutFlow (double w)
         oneDHists_.at ("cutFlow")->Fill    (bin,  w);
       bin++;
     }
-  if (!cutDecisions->metFilters.empty ())
+  if (!cutSchema_.metFilters.empty ())
     {
       passes = passes && cutDecisions->metFilterDecision;
       if (cutDecisions->metFilterDecision)
@@ -263,16 +267,16 @@ CutFlowPlotter::fillCutFlow (double w)
       bin++;
     }
   double firstBin = bin;  // save the index of the first bin corresponding to an actual cut
-  for (vector<bool>::const_iterator flag = cutDecisions->cumulativeEventFlags.begin (); flag != cutDecisions->cumulativeEventFlags.end (); flag++, bin++)
+  for (unsigned flag = 0; flag != cutDecisions->cumulativeEventFlags.size (); flag++, bin++)
     {
-      passes = passes && (*flag);
+      passes = passes && cutDecisions->cumulativeEventFlags.at (flag);
       if (passes)
         oneDHists_.at ("cutFlow")->Fill (bin, w);
     }
   bin = firstBin;  // reset to the first bin with an actual cut
-  for (vector<bool>::const_iterator flag = cutDecisions->individualEventFlags.begin (); flag != cutDecisions->individualEventFlags.end (); flag++, bin++)
+  for (unsigned flag = 0; flag != cutDecisions->individualEventFlags.size (); flag++, bin++)
     {
-      if (*flag)
+      if (cutDecisions->individualEventFlags.at (flag))
         oneDHists_.at ("selection")->Fill (bin, w);
     }
   //////////////////////////////////////////////////////////////////////////////
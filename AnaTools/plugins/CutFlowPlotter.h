@@ -6,6 +6,7 @@
 #include "FWCore/Framework/interface/EDAnalyzer.h"
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/EventSetup.h"
+#include "FWCore/Framework/interface/Run.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/ServiceRegistry/interface/Service.h"
 
@@ -19,6 +20,7 @@ class CutFlowPlotter : public edm::EDAnalyzer
     CutFlowPlotter (const edm::ParameterSet &);
     ~CutFlowPlotter ();
 
+    void beginRun (const edm::Run &, const edm::EventSetup &);
     void analyze (const edm::Event &, const edm::EventSetup &);
 
   private:
@@ -33,16 +35,18 @@ class CutFlowPlotter : public edm::EDAnalyzer
     string             module_type_;
     string             module_label_;
     bool               firstEvent_;
-    vector<string>     triggers_;
-    vector<string>     triggersToVeto_;
-    vector<string>     triggerFilters_;
-    vector<string>     metFilters_;
     ////////////////////////////////////////////////////////////////////////////
 
-    // Objects which can be gotten from the event.
+    // Private copy of the names of the cuts and triggers, which is also needed
+    // in the destructor, when the terminal output is produced.
+    CutSchema          cutSchema_;
+
+    // Objects which can be gotten from the event and the run.
     edm::Handle<CutCalculatorPayload> cutDecisions;
+    edm::Handle<CutSchema> cutSchema;
     edm::Handle<TYPE(generatorweights)> generatorweights;
     edm::EDGetTokenT<CutCalculatorPayload> cutDecisionsToken_;
+    edm::EDGetTokenT<CutSchema> cutSchemaToken_;
     edm::EDGetTokenT<TYPE(generatorweights)> generatorweightsToken_;
 
     ////////////////////////////////////////////////////////////////////////////
@@ -10,7 +10,6 @@
 InfoPrinter::InfoPrinter (const edm::ParameterSet &cfg) :
   collections_                 (cfg.getParameter<edm::ParameterSet>    ("collections")),
   cutDecisions_                (cfg.getParameter<edm::InputTag>        ("cutDecisions")),
-  eventsToPrint_               (cfg.getParameter<vector<edm::EventID>  >                                 ("eventsToPrint")),
   printAllEvents_              (cfg.getParameter<bool>                 ("printAllEvents")),
   printPassedEvents_           (cfg.getParameter<bool>                 ("printPassedEvents")),
   printCumulativeObjectFlags_  (cfg.getParameter<bool>                 ("printCumulativeObjectFlags")),
@@ -30,6 +29,7 @@ InfoPrinter::InfoPrinter (const edm::ParameterSet &cfg) :
   printAllTriggerFilters_      (cfg.getParameter<bool>                 ("printAllTriggerFilters")),
   printAllMETFilters_          (cfg.getParameter<bool>                 ("printAllMETFilters")),
   valuesToPrint_               (cfg.getParameter<edm::VParameterSet>   ("valuesToPrint")),
+  outputBufferSize_            (cfg.exists ("outputBufferSize") ? cfg.getParameter<unsigned> ("outputBufferSize") : 1024 * 1024 * 10),
   firstEvent_ (true),
   counter_ (0),
   sw_ (new TStopwatch)
@@ -37,10 +37,14 @@ InfoPrinter::InfoPrinter (const edm::ParameterSet &cfg) :
   // Start the timer.
   sw_->Start ();
 
+  const vector<edm::EventID> eventsToPrint = cfg.getParameter<vector<edm::EventID> > ("eventsToPrint");
+  eventsToPrint_.insert (eventsToPrint.begin (), eventsToPrint.end ());
+
   unpackValuesToPrint ();
 
   anatools::getAllTokens (collections_, consumesCollector (), tokens_);
   cutDecisionsToken_ = consumes<CutCalculatorPayload> (cutDecisions_);
+  cutSchemaToken_ = consumes<CutSchema, edm::InRun> (cutDecisions_);
 }
 
 InfoPrinter::~InfoPrinter ()
@@ -52,7 +56,7 @@ InfoPrinter::~InfoPrinter ()
   flushPassingEvents ();
   sw_->Stop ();
   outputTime ();
-  clog << ss_.str ();
+  flushOutput ();
   //////////////////////////////////////////////////////////////////////////////
 
   for (auto &value : valuesToPrint)
@@ -60,13 +64,25 @@ InfoPrinter::~InfoPrinter ()
   delete sw_;
 }
 
+void
+InfoPrinter::beginRun (const edm::Run &run, const edm::EventSetup &setup)
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Get the names of the cuts and triggers out of the run.
+  //////////////////////////////////////////////////////////////////////////////
+  run.getByToken (cutSchemaToken_, cutSchema);
+  if (cutSchema.isValid ())
+    cutSchema_ = *cutSchema;
+  else
+    clog << "WARNING: failed to retrieve cut schema from the run." << endl;
+  //////////////////////////////////////////////////////////////////////////////
+}
+
 void
 InfoPrinter::analyze (const edm::Event &event, const edm::EventSetup &setup)
 {
   counter_++;
 
-  anatools::getRequiredCollections (objectsToGet_, handles_, event, tokens_);
-
   //////////////////////////////////////////////////////////////////////////////
   // Get the cut decisions out of the event.
   //////////////////////////////////////////////////////////////////////////////
@@ -75,35 +91,31 @@ InfoPrinter::analyze (const edm::Event &event, const edm::EventSetup &setup)
     clog << "WARNING: failed to retrieve cut decisions from the event." << endl;
   //////////////////////////////////////////////////////////////////////////////
 
-  //////////////////////////////////////////////////////////////////////////////
-  // Set all the private variables in the ValueLookup object before using it,
-  // and parse the cut strings in the unpacked cuts into ValueLookupTree
-  // objects.
-  //////////////////////////////////////////////////////////////////////////////
-  if (!initializeValueLookupForest (valuesToPrint, &handles_))
-    {
-      clog << "ERROR: failed to parse all cut strings. Quitting..." << endl;
-      exit (EXIT_CODE);
-    }
-  //////////////////////////////////////////////////////////////////////////////
-
   //////////////////////////////////////////////////////////////////////////////
   // For each type of information requested by the user, and for each event
-  // requested, print that information to the stringstream which is printed in
-  // the destructor.
+  // requested, print that information to the stringstream which is flushed
+  // to the screen as it fills up.
   //////////////////////////////////////////////////////////////////////////////
   maxCutWidth_ = maxTriggerWidth_ = maxVetoTriggerWidth_ = maxValueWidth_ = maxAllTriggerWidth_ = maxAllTriggerCollectionWidth_ = maxAllTriggerFilterWidth_ = maxAllTriggerPathWidth_ = maxMETFilterWidth_ = maxAllMETFilterWidth_ = 0;
 
   bool eventDecision = getEventDecision(),
-       printEvent = printAllEvents_ || (printPassedEvents_ && eventDecision);
-  for (auto eventToPrint = eventsToPrint_.begin (); eventToPrint != eventsToPrint_.end (); eventToPrint++)
-    {
-      if ((*eventToPrint) == event.id ())
-        printEvent = true;
-    }
+       printEvent = printAllEvents_ || (printPassedEvents_ && eventDecision) || eventsToPrint_.count (event.id ());
 
   if (printEvent)
     {
+      //////////////////////////////////////////////////////////////////////////
+      // The collections are only needed for the values to print and the
+      // triggers, so they are only gotten for events which are printed. The
+      // ValueLookupTree objects are likewise only set up and evaluated here.
+      //////////////////////////////////////////////////////////////////////////
+      anatools::getRequiredCollections (objectsToGet_, handles_, event, tokens_);
+      if (!initializeValueLookupForest (valuesToPrint, &handles_))
+        {
+          clog << "ERROR: failed to parse all cut strings. Quitting..." << endl;
+          exit (EXIT_CODE);
+        }
+      //////////////////////////////////////////////////////////////////////////
+
       ss_ << endl << "================================================================================" << endl;
       ss_ << A_BRIGHT_CYAN << "info for " << event.id () << " (record " << counter_ << ")" << A_RESET << endl;
       !valuesToPrint.empty ()      &&  printValuesToPrint          ();
@@ -124,11 +136,12 @@ InfoPrinter::analyze (const edm::Event &event, const edm::EventSetup &setup)
       printAllTriggerFilters_      &&  printAllTriggerFilters      (event);
       printAllMETFilters_          &&  printAllMETFilters          (event);
       ss_ << "================================================================================" << endl;
+      flushOutput (outputBufferSize_);
     }
   if (eventDecision)
     {
       passingEvents_ << "EVENT PASSED (" << event.id () << ")" << endl;
-      flushPassingEvents (1024 * 1024 * 10);
+      flushPassingEvents (outputBufferSize_);
     }
   //////////////////////////////////////////////////////////////////////////////
 
@@ -206,14 +219,14 @@ InfoPrinter::printCumulativeEventFlags ()
     return false;
 
   ss_ << endl;
-  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutDecisions->cuts));
+  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutSchema_.cutNames));
   ss_ << "--------------------------------------------------------------------------------" << endl;
   ss_ << A_BRIGHT_MAGENTA << "cumulative event flags" << A_RESET << endl;
   ss_ << "--------------------------------------------------------------------------------" << endl;
-  for (auto flag = cutDecisions->cumulativeEventFlags.begin (); flag != cutDecisions->cumulativeEventFlags.end (); flag++)
+  for (unsigned flag = 0; flag != cutDecisions->cumulativeEventFlags.size (); flag++)
     {
-      ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutDecisions->cuts.at (flag - cutDecisions->cumulativeEventFlags.begin ()).name << A_RESET;
-      if (*flag)
+      ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutSchema_.cutNames.at (flag) << A_RESET;
+      if (cutDecisions->cumulativeEventFlags.at (flag))
         ss_ << A_BRIGHT_GREEN << "true" << A_RESET << endl;
       else
         ss_ << A_BRIGHT_RED << "false" << A_RESET << endl;
@@ -228,14 +241,14 @@ InfoPrinter::printIndividualEventFlags ()
     return false;
 
   ss_ << endl;
-  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutDecisions->cuts));
+  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutSchema_.cutNames));
   ss_ << "--------------------------------------------------------------------------------" << endl;
   ss_ << A_BRIGHT_MAGENTA << "individual event flags" << A_RESET << endl;
   ss_ << "--------------------------------------------------------------------------------" << endl;
-  for (auto flag = cutDecisions->individualEventFlags.begin (); flag != cutDecisions->individualEventFlags.end (); flag++)
+  for (unsigned flag = 0; flag != cutDecisions->individualEventFlags.size (); flag++)
     {
-      ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutDecisions->cuts.at (flag - cutDecisions->individualEventFlags.begin ()).name << A_RESET;
-      if (*flag)
+      ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutSchema_.cutNames.at (flag) << A_RESET;
+      if (cutDecisions->individualEventFlags.at (flag))
         ss_ << A_BRIGHT_GREEN << "true" << A_RESET << endl;
       else
         ss_ << A_BRIGHT_RED << "false" << A_RESET << endl;
@@ -250,13 +263,15 @@ InfoPrinter::printCumulativeObjectFlags ()
     return false;
 
   ss_ << endl;
-  if (cutDecisions->cumulativeObjectFlags.empty ())
+  FlagMap cumulativeObjectFlags;
+  anatools::unpackObjectFlags (cutDecisions->cumulativeObjectFlags, cutSchema_.collections, cumulativeObjectFlags);
+  if (cumulativeObjectFlags.empty ())
     return true;
   vector<string> collections;
-  for (const auto &collection : cutDecisions->cumulativeObjectFlags.at (0))
+  for (const auto &collection : cumulativeObjectFlags.at (0))
     collections.push_back (collection.first);
   sort (collections.begin (), collections.end ());
-  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutDecisions->cuts));
+  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutSchema_.cutNames));
   for (auto collection = collections.begin (); collection != collections.end (); collection++)
     {
       if (collection != collections.begin ())
@@ -264,9 +279,9 @@ InfoPrinter::printCumulativeObjectFlags ()
       ss_ << "--------------------------------------------------------------------------------" << endl;
       ss_ << A_BRIGHT_MAGENTA << "cumulative object flags for " << *collection << A_RESET << endl;
       ss_ << "--------------------------------------------------------------------------------" << endl;
-      for (auto cut = cutDecisions->cumulativeObjectFlags.begin (); cut != cutDecisions->cumulativeObjectFlags.end (); cut++)
+      for (auto cut = cumulativeObjectFlags.begin (); cut != cumulativeObjectFlags.end (); cut++)
         {
-          ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutDecisions->cuts.at (cut - cutDecisions->cumulativeObjectFlags.begin ()).name << A_RESET;
+          ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutSchema_.cutNames.at (cut - cumulativeObjectFlags.begin ()) << A_RESET;
           for (auto flag = cut->at (*collection).begin (); flag != cut->at (*collection).end (); flag++)
             {
               if (flag != cut->at (*collection).begin ())
@@ -296,13 +311,15 @@ InfoPrinter::printIndividualObjectFlags ()
     return false;
 
   ss_ << endl;
-  if (cutDecisions->individualObjectFlags.empty ())
+  FlagMap individualObjectFlags;
+  anatools::unpackObjectFlags (cutDecisions->individualObjectFlags, cutSchema_.collections, individualObjectFlags);
+  if (individualObjectFlags.empty ())
     return true;
   vector<string> collections;
-  for (const auto &collection : cutDecisions->individualObjectFlags.at (0))
+  for (const auto &collection : individualObjectFlags.at (0))
     collections.push_back (collection.first);
   sort (collections.begin (), collections.end ());
-  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutDecisions->cuts));
+  !maxCutWidth_ && (maxCutWidth_ = getMaxWidth (cutSchema_.cutNames));
   for (auto collection = collections.begin (); collection != collections.end (); collection++)
     {
       if (collection != collections.begin ())
@@ -310,9 +327,9 @@ InfoPrinter::printIndividualObjectFlags ()
       ss_ << "--------------------------------------------------------------------------------" << endl;
       ss_ << A_BRIGHT_MAGENTA << "individual object flags for " << *collection << A_RESET << endl;
       ss_ << "--------------------------------------------------------------------------------" << endl;
-      for (auto cut = cutDecisions->individualObjectFlags.begin (); cut != cutDecisions->individualObjectFlags.end (); cut++)
+      for (auto cut = individualObjectFlags.begin (); cut != individualObjectFlags.end (); cut++)
         {
-          ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutDecisions->cuts.at (cut - cutDecisions->individualObjectFlags.begin ()).name << A_RESET;
+          ss_ << A_BRIGHT_BLUE << setw (maxCutWidth_) << left << cutSchema_.cutNames.at (cut - individualObjectFlags.begin ()) << A_RESET;
           for (auto flag = cut->at (*collection).begin (); flag != cut->at (*collection).end (); flag++)
             {
               if (flag != cut->at (*collection).begin ())
@@ -342,14 +359,14 @@ InfoPrinter::printTriggerFlags ()
     return false;
 
   ss_ << endl;
-  !maxTriggerWidth_ && (maxTriggerWidth_ = getMaxWidth (cutDecisions->triggers));
+  !maxTriggerWidth_ && (maxTriggerWidth_ = getMaxWidth (cutSchema_.triggers));
   ss_ << "--------------------------------------------------------------------------------" << endl;
   ss_ << A_BRIGHT_MAGENTA << "trigger flags" << A_RESET << endl;
   ss_ << "--------------------------------------------------------------------------------" << endl;
-  for (auto flag = cutDecisions->triggerFlags.begin (); flag != cutDecisions->triggerFlags.end (); flag++)
+  for (unsigned flag = 0; flag != cutDecisions->triggerFlags.size (); flag++)
     {
-      ss_ << A_BRIGHT_BLUE << setw (maxTriggerWidth_) << left << cutDecisions->triggers.at (flag - cutDecisions->triggerFlags.begin ()) << A_RESET;
-      if (*flag)
+      ss_ << A_BRIGHT_BLUE << setw (maxTriggerWidth_) << left << cutSchema_.triggers.at (flag) << A_RESET;
+      if (cutDecisions->triggerFlags.at (flag))
         ss_ << A_BRIGHT_GREEN << "true" << A_RESET << endl;
       else
         ss_ << A_BRIGHT_RED << "false" << A_RESET << endl;
@@ -365,14 +382,14 @@ InfoPrinter::printVetoTriggerFlags ()
     return false;
 
   ss_ << endl;
-  !maxVetoTriggerWidth_ && (maxVetoTriggerWidth_ = getMaxWidth (cutDecisions->triggersToVeto));
+  !maxVetoTriggerWidth_ && (maxVetoTriggerWidth_ = getMaxWidth (cutSchema_.triggersToVeto));
   ss_ << "--------------------------------------------------------------------------------" << endl;
   ss_ << A_BRIGHT_MAGENTA << "veto trigger flags" << A_RESET << endl;
   ss_ << "--------------------------------------------------------------------------------" << endl;
-  for (auto flag = cutDecisions->vetoTriggerFlags.begin (); flag != cutDecisions->vetoTriggerFlags.end (); flag++)
+  for (unsigned flag = 0; flag != cutDecisions->vetoTriggerFlags.size (); flag++)
     {
-      ss_ << A_BRIGHT_BLUE << setw (maxVetoTriggerWidth_) << left << cutDecisions->triggersToVeto.at (flag - cutDecisions->vetoTriggerFlags.begin ()) << A_RESET;
-      if (*flag)
+      ss_ << A_BRIGHT_BLUE << setw (maxVetoTriggerWidth_) << left << cutSchema_.triggersToVeto.at (flag) << A_RESET;
+      if (cutDecisions->vetoTriggerFlags.at (flag))
         ss_ << A_BRIGHT_GREEN << "true" << A_RESET << endl;
       else
         ss_ << A_BRIGHT_RED << "false" << A_RESET << endl;
@@ -388,14 +405,14 @@ InfoPrinter::printTriggerFilterFlags ()
     return false;
 
   ss_ << endl;
-  !maxTriggerWidth_ && (maxTriggerWidth_ = getMaxWidth (cutDecisions->triggerFilters));
+  !maxTriggerWidth_ && (maxTriggerWidth_ = getMaxWidth (cutSchema_.triggerFilters));
   ss_ << "--------------------------------------------------------------------------------" << endl;
   ss_ << A_BRIGHT_MAGENTA << "trigger filter flags" << A_RESET << endl;
   ss_ << "--------------------------------------------------------------------------------" << endl;
-  for (auto flag = cutDecisions->triggerFilterFlags.begin (); flag != cutDecisions->triggerFilterFlags.end (); flag++)
+  for (unsigned flag = 0; flag != cutDecisions->triggerFilterFlags.size (); flag++)
     {
-      ss_ << A_BRIGHT_BLUE << setw (maxTriggerWidth_) << left << cutDecisions->triggerFilters.at (flag - cutDecisions->triggerFilterFlags.begin ()) << A_RESET;
-      if (*flag)
+      ss_ << A_BRIGHT_BLUE << setw (maxTriggerWidth_) << left << cutSchema_.triggerFilters.at (flag) << A_RESET;
+      if (cutDecisions->triggerFilterFlags.at (flag))
         ss_ << A_BRIGHT_GREEN << "true" << A_RESET << endl;
       else
         ss_ << A_BRIGHT_RED << "false" << A_RESET << endl;
@@ -411,14 +428,14 @@ InfoPrinter::printTriggerInMenuFlags ()
     return false;
 
   ss_ << endl;
-  !maxTriggerWidth_ && (maxTriggerWidth_ = getMaxWidth (cutDecisions->triggersInMenu));
+  !maxTriggerWidth_ && (maxTriggerWidth_ = getMaxWidth (cutSchema_.triggersInMenu));
   ss_ << "--------------------------------------------------------------------------------" << endl;
   ss_ << A_BRIGHT_MAGENTA << "trigger in menu flags" << A_RESET << endl;
   ss_ << "--------------------------------------------------------------------------------" << endl;
-  for (auto flag = cutDecisions->triggerInMenuFlags.begin (); flag != cutDecisions->triggerInMenuFlags.end (); flag++)
+  for (unsigned flag = 0; flag != cutDecisions->triggerInMenuFlags.size (); flag++)
     {
-      ss_ << A_BRIGHT_BLUE << setw (maxTriggerWidth_) << left << cutDecisions->triggersInMenu.at (flag - cutDecisions->triggerInMenuFlags.begin ()) << A_RESET;
-      if (*flag)
+      ss_ << A_BRIGHT_BLUE << setw (maxTriggerWidth_) << left << cutSchema_.triggersInMenu.at (flag) << A_RESET;
+      if (cutDecisions->triggerInMenuFlags.at (flag))
         ss_ << A_BRIGHT_GREEN << "true" << A_RESET << endl;
       else
         ss_ << A_BRIGHT_RED << "false" << A_RESET << endl;
@@ -434,14 +451,14 @@ InfoPrinter::printMETFilterFlags ()
     return false;
 
   ss_ << endl;
-  !maxMETFilterWidth_ && (maxMETFilterWidth_ = getMaxWidth (cutDecisions->metFilters));
+  !maxMETFilterWidth_ && (maxMETFilterWidth_ = getMaxWidth (cutSchema_.metFilters));
   ss_ << "--------------------------------------------------------------------------------" << endl;
   ss_ << A_BRIGHT_MAGENTA << "MET filter flags" << A_RESET << endl;
   ss_ << "--------------------------------------------------------------------------------" << endl;
-  for (auto flag = cutDecisions->metFilterFlags.begin (); flag != cutDecisions->metFilterFlags.end (); flag++)
+  for (unsigned flag = 0; flag != cutDecisions->metFilterFlags.size (); flag++)
     {
-      ss_ << A_BRIGHT_BLUE << setw (maxMETFilterWidth_) << left << cutDecisions->metFilters.at (flag - cutDecisions->metFilterFlags.begin ()) << A_RESET;
-      if (*flag)
+      ss_ << A_BRIGHT_BLUE << setw (maxMETFilterWidth_) << left << cutSchema_.metFilters.at (flag) << A_RESET;
+      if (cutDecisions->metFilterFlags.at (flag))
         ss_ << A_BRIGHT_GREEN << "true" << A_RESET << endl;
       else
         ss_ << A_BRIGHT_RED << "false" << A_RESET << endl;
@@ -461,9 +478,10 @@ InfoPrinter::printValuesToPrint ()
   for (const auto &valueToPrint : valuesToPrint)
     {
       ss_ << A_BRIGHT_BLUE << setw (maxValueWidth_) << left << (valueToPrint.inputLabel + ": " + valueToPrint.valueToPrint) << A_RESET;
-      for (auto value = valueToPrint.valueLookupTree->evaluate ().begin (); value != valueToPrint.valueLookupTree->evaluate ().end (); value++)
+      const auto &values = valueToPrint.valueLookupTree->evaluate ();
+      for (auto value = values.begin (); value != values.end (); value++)
         {
-          if (value != valueToPrint.valueLookupTree->evaluate ().begin ())
+          if (value != values.begin ())
             ss_ << ", ";
           double v = boost::get<double> (*value);
           if (!IS_INVALID(v))
@@ -677,27 +695,6 @@ InfoPrinter::getMaxWidth (const map<string, pair<bool, unsigned> > &list) const
   return w;
 }
 
-unsigned
-InfoPrinter::getMaxWidth (const Cuts &list) const
-{
-  //////////////////////////////////////////////////////////////////////////////
-  // Calculate the maximum length of the names of cuts in a vector.
-  //////////////////////////////////////////////////////////////////////////////
-  unsigned w = 0;
-  for (const auto &cut : list)
-    {
-      if (cut.name.length () > w)
-        w = cut.name.length ();
-    }
-  //////////////////////////////////////////////////////////////////////////////
-
-  // Add two to the maximum length so that there are at least two spaces before
-  // the next column in the table.
-  w += 2;
-
-  return w;
-}
-
 unsigned
 InfoPrinter::getMaxWidth (const ValuesToPrint &list) const
 {
@@ -768,6 +765,7 @@ InfoPrinter::unpackValuesToPrint ()
       sort (valuesToPrint.back ().inputCollections.begin (), valuesToPrint.back ().inputCollections.end ());
       valuesToPrint.back ().inputLabel = anatools::concatenateInputCollection (valuesToPrint.back ().inputCollections);
       valuesToPrint.back ().valueToPrint = value.getParameter<string> ("valueToPrint");
+      valuesToPrint.back ().valueLookupTree = NULL;
 
       objectsToGet_.insert (valuesToPrint.back ().inputCollections.begin (), valuesToPrint.back ().inputCollections.end ());
     }
@@ -790,7 +788,7 @@ InfoPrinter::initializeValueLookupForest (ValuesToPrint &values, Collections * c
 {
   for (auto &value : values)
     {
-      if (firstEvent_)
+      if (!value.valueLookupTree)
         {
           value.valueLookupTree = new ValueLookupTree (value);
           if (!value.valueLookupTree->isValid ())
@@ -804,12 +802,22 @@ InfoPrinter::initializeValueLookupForest (ValuesToPrint &values, Collections * c
 void
 InfoPrinter::flushPassingEvents (const unsigned maxLength)
 {
-  if (passingEvents_.str ().length () > maxLength)
+  if (passingEvents_.tellp () > maxLength)
     {
       edm::LogInfo ("InfoPrinter") << passingEvents_.str ();
       passingEvents_.str ("");
     }
 }
 
+void
+InfoPrinter::flushOutput (const unsigned maxLength)
+{
+  if (ss_.tellp () > maxLength)
+    {
+      clog << ss_.str () << flush;
+      ss_.str ("");
+    }
+}
+
 #include "FWCore/Framework/interface/MakerMacros.h"
 DEFINE_FWK_MODULE(InfoPrinter);
@@ -11,18 +11,33 @@
 #include "FWCore/Framework/interface/EDAnalyzer.h"
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/EventSetup.h"
+#include "FWCore/Framework/interface/Run.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 
 #include "TStopwatch.h"
 
 #include "OSUT3Analysis/AnaTools/interface/AnalysisTypes.h"
 
+// Hash of an edm::EventID, so that the events to print can be looked up in an
+// unordered_set.
+struct EventIDHash
+{
+  size_t operator() (const edm::EventID &id) const
+  {
+    size_t h = hash<unsigned long long> () (id.event ());
+    h ^= hash<unsigned> () (id.luminosityBlock ()) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= hash<unsigned> () (id.run ()) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+  }
+};
+
 class InfoPrinter : public edm::EDAnalyzer
 {
   public:
     InfoPrinter (const edm::ParameterSet &);
     ~InfoPrinter ();
 
+    void beginRun (const edm::Run &, const edm::EventSetup &);
     void analyze (const edm::Event &, const edm::EventSetup &);
 
   private:
@@ -49,6 +64,7 @@ class InfoPrinter : public edm::EDAnalyzer
     bool printAllTriggerFilters (const edm::Event &);
     bool printAllMETFilters (const edm::Event &);
     void flushPassingEvents (const unsigned = 0);
+    void flushOutput (const unsigned = 0);
     ////////////////////////////////////////////////////////////////////////////
 
     ////////////////////////////////////////////////////////////////////////////
@@ -58,7 +74,6 @@ class InfoPrinter : public edm::EDAnalyzer
     unsigned getMaxWidth (const vector<string> &) const;
     unsigned getMaxWidth (const map<string, bool> &) const;
     unsigned getMaxWidth (const map<string, pair<bool, unsigned> > &) const;
-    unsigned getMaxWidth (const Cuts &) const;
     unsigned getMaxWidth (const ValuesToPrint &) const;
     ////////////////////////////////////////////////////////////////////////////
 
@@ -74,7 +89,7 @@ class InfoPrinter : public edm::EDAnalyzer
     ////////////////////////////////////////////////////////////////////////////
     edm::ParameterSet     collections_;
     edm::InputTag         cutDecisions_;
-    vector<edm::EventID>  eventsToPrint_;
+    unordered_set<edm::EventID, EventIDHash>  eventsToPrint_;
     bool                  printAllEvents_;
     bool                  printPassedEvents_;
     bool                  printCumulativeObjectFlags_;
@@ -94,6 +109,7 @@ class InfoPrinter : public edm::EDAnalyzer
     bool                  printAllTriggerFilters_;
     bool                  printAllMETFilters_;
     edm::VParameterSet    valuesToPrint_;
+    unsigned              outputBufferSize_;
     bool                  firstEvent_;
     unsigned              counter_;
     ////////////////////////////////////////////////////////////////////////////
@@ -105,17 +121,22 @@ class InfoPrinter : public edm::EDAnalyzer
     // Stopwatch for timing the code.
     TStopwatch *sw_;
 
-    // Stringstream which holds all the information to be printed until the
-    // destructor is called, where it is printed to the screen.
+    // Stringstream which acts as a buffer to hold the information to be
+    // printed. It is printed to the screen whenever it grows beyond
+    // outputBufferSize_ bytes, and in the destructor.
     stringstream ss_;
 
     // Stringstream which acts as a buffer to hold event numbers for passing
     // events.
     stringstream passingEvents_;
 
-    // Cut decisions which are gotten from the event.
+    // Cut decisions which are gotten from the event, and the names of the
+    // cuts and triggers they refer to, which are gotten from the run.
     edm::Handle<CutCalculatorPayload> cutDecisions;
+    edm::Handle<CutSchema> cutSchema;
     edm::EDGetTokenT<CutCalculatorPayload> cutDecisionsToken_;
+    edm::EDGetTokenT<CutSchema> cutSchemaToken_;
+    CutSchema cutSchema_;
 
     ValuesToPrint valuesToPrint;
 
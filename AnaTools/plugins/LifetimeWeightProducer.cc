@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <vector>
 #include <unordered_set>
 #include <sstream>
@@ -10,6 +11,21 @@ LifetimeWeightProducer::LifetimeWeightProducer (const edm::ParameterSet &cfg) :
   dstCTau_ (cfg.getParameter<vector<double> > ("dstCTau")),
   pdgIds_ (cfg.getParameter<vector<int> > ("pdgIds"))
 {
+  if (cfg.exists ("dstCTauGrid"))
+    dstCTauGrid_ = cfg.getParameter<vector<double> > ("dstCTauGrid");
+
+  // The weight for each target lifetime in the grid is named, e.g.,
+  // lifetimeWeight_10 for 10 cm or lifetimeWeight_0p2 for 0.2 cm, since a
+  // decimal point cannot appear in the name of an event variable.
+  for (const auto &dstCTau : dstCTauGrid_)
+    {
+      stringstream name;
+      name << "lifetimeWeight_" << dstCTau;
+      string gridName = name.str ();
+      replace (gridName.begin (), gridName.end (), '.', 'p');
+      dstCTauGridNames_.push_back (gridName);
+    }
+
   mcparticlesToken_ = consumes<vector<TYPE(hardInteractionMcparticles)> > (collections_.getParameter<edm::InputTag> ("hardInteractionMcparticles"));
 }
 
@@ -18,11 +34,14 @@ LifetimeWeightProducer::~LifetimeWeightProducer() {}
 void
 LifetimeWeightProducer::AddVariables (const edm::Event &event) {
   double weight = 1.0;
+  vector<double> gridWeights (dstCTauGrid_.size (), 1.0);
 #ifndef STOPPPED_PTLS
   edm::Handle<vector<TYPE(hardInteractionMcparticles)> > mcparticles;
   if (!event.getByToken (mcparticlesToken_, mcparticles))
     {
       (*eventvariables)["lifetimeWeight"] = weight;
+      for (const auto &gridName : dstCTauGridNames_)
+        (*eventvariables)[gridName] = 1.0;
       return;
     }
 
@@ -49,12 +68,14 @@ LifetimeWeightProducer::AddVariables (const edm::Event &event) {
           suffix.str ("");
           suffix << "_" << abs (pdgIds_.at (iPdgId)) << "_" << index++;
           (*eventvariables)["cTau" + suffix.str ()] = cTau;
-
-          double srcPDF = exp (-cTau / srcCTau_.at (iPdgId)) / srcCTau_.at (iPdgId),
-                 dstPDF = exp (-cTau / dstCTau_.at (iPdgId)) / dstCTau_.at (iPdgId);
-          weight *= (dstPDF / srcPDF);
         }
 
+      // The weights for all of the target lifetimes are calculated from the
+      // same decay lengths.
+      weight *= getWeight (cTaus.at (iPdgId), srcCTau_.at (iPdgId), dstCTau_.at (iPdgId));
+      for (unsigned iGrid = 0; iGrid < dstCTauGrid_.size (); iGrid++)
+        gridWeights.at (iGrid) *= getWeight (cTaus.at (iPdgId), srcCTau_.at (iPdgId), dstCTauGrid_.at (iGrid));
+
       // Add dummy ctau values for index < 10 for signal with varying numbers
       // of particles used for reweighting; e.g., a mix of chargino-chargino
       // and chargino-neutralino events, where the chargino is used for
@@ -68,15 +89,37 @@ LifetimeWeightProducer::AddVariables (const edm::Event &event) {
     }
 #endif // ifndef STOPPPED_PTLS
   (*eventvariables)["lifetimeWeight"] = weight;
+  for (unsigned iGrid = 0; iGrid < dstCTauGrid_.size (); iGrid++)
+    (*eventvariables)[dstCTauGridNames_.at (iGrid)] = gridWeights.at (iGrid);
+}
+
+// Returns the product over the given decay lengths of the ratio of the
+// exponential PDFs with the target and original lifetimes.
+double
+LifetimeWeightProducer::getWeight (const vector<double> &cTaus, const double srcCTau, const double dstCTau) const
+{
+  double weight = 1.0;
+  for (const auto &cTau : cTaus)
+    {
+      double srcPDF = exp (-cTau / srcCTau) / srcCTau,
+             dstPDF = exp (-cTau / dstCTau) / dstCTau;
+      weight *= (dstPDF / srcPDF);
+    }
+  return weight;
 }
 
 bool
-LifetimeWeightProducer::isOriginalParticle (const TYPE(hardInteractionMcparticles) &mcparticle, const int pdgId) const
+LifetimeWeightProducer::isOriginalParticle (const reco::Candidate &mcparticle, const int pdgId) const
 {
 #ifndef STOPPPED_PTLS
-  if (!mcparticle.numberOfMothers () || mcparticle.motherRef ().isNull ())
-    return true;
-  return (mcparticle.motherRef ()->pdgId () != pdgId) && isOriginalParticle ((TYPE(hardInteractionMcparticles)) *mcparticle.motherRef (), pdgId);
+  // Follow the first mother of each particle up the decay chain, without
+  // copying any of them.
+  for (const reco::Candidate *mother = mcparticle.mother (); mother; mother = mother->mother ())
+    {
+      if (mother->pdgId () == pdgId)
+        return false;
+    }
+  return true;
 #else
   return false;
 #endif
@@ -16,7 +16,13 @@ class LifetimeWeightProducer : public EventVariableProducer
         vector<double> dstCTau_;
         vector<int> pdgIds_;
 
-        bool isOriginalParticle (const TYPE(hardInteractionMcparticles) &, const int) const;
+        // Additional target lifetimes, each applied to all of the particles in
+        // pdgIds_, and the names of the event variables holding their weights.
+        vector<double> dstCTauGrid_;
+        vector<string> dstCTauGridNames_;
+
+        bool isOriginalParticle (const reco::Candidate &, const int) const;
+        double getWeight (const vector<double> &, const double, const double) const;
         double getCTau (const TYPE(hardInteractionMcparticles) &) const;
         void getFinalPosition (const reco::Candidate &, const int, bool, math::XYZPoint &) const;
 
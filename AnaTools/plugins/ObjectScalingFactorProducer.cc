@@ -3,7 +3,9 @@
 #include <typeinfo>
 
 ObjectScalingFactorProducer::ObjectScalingFactorProducer(const edm::ParameterSet &cfg) :
-  EventVariableProducer(cfg)
+  EventVariableProducer(cfg),
+  muonGraphsLoaded_ (false),
+  muonHistogramsUsed_ (true)
 {
 
   if (cfg.exists ("electronFile"))
@@ -87,7 +89,7 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
   if(find(objectsToGet_.begin(), objectsToGet_.end(), "muons") != objectsToGet_.end())
     doMuons = true;
 
-  if (doMuons) {
+  if (doMuons && (!muonGraphsLoaded_ || muonHistogramsUsed_)) {
     muonInputFile = TFile::Open (muonFile_.c_str ());
     if (!muonInputFile || muonInputFile->IsZombie()) {
       clog << "ERROR [ObjectScalingFactorProducer]: Could not find file: " << muonFile_
@@ -95,9 +97,12 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
       exit(1);
     }
   }
+  if (doMuons && !muonGraphsLoaded_)
+    loadMuonGraphs (muonInputFile);
 
   // loop over desired scale factors, treating each case independently
-  for (auto &sf : scaleFactors_){
+  for (unsigned iSF = 0; iSF < scaleFactors_.size(); iSF++){
+    const ScaleFactor &sf = scaleFactors_[iSF];
     double sfCentral = 1;
     double sfDown = 1;
     double sfUp = 1;
@@ -116,7 +121,7 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
       float xMax = plot->GetXaxis()->GetBinCenter(plot->GetNbinsX());
       float yMin = plot->GetYaxis()->GetBinCenter(1);
       float yMax = plot->GetYaxis()->GetBinCenter(plot->GetNbinsY());
-      for (const auto &electron1 : *handles_.electrons) {
+      for (const auto &electron1 : anatools::selectedObjects (handles_.electrons, handles_, "electrons")) {
          float eta = electron1.eta();
          // the 2015 ID plots are in |eta| yet the rest are in eta, so check xMin
          if(xMin >= 0) eta = abs(eta);
@@ -147,63 +152,36 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
     // also can be either TH2F's or TGraphAsymmErrors, so test for each case
     else if (doMuons && sf.inputCollection == "muons") {
 
-      TObject * tempObj = muonInputFile->Get(sf.inputPlots[0].c_str());
-      if(!tempObj) {
-        clog << "ERROR [ObjectScalingFactorProducer]: Could not find object: " << sf.inputPlots[0]
-             << "; will cause a seg fault." << endl;
-        exit(1);
-      }
-
       int numPlots = sf.inputPlots.size();
       vector<float> valuesByEra, valuesByEraUp, valuesByEraDown;
+      const GraphSFWeight *graphs = muonGraphs_.at(iSF).get();
+      TObject * tempObj = 0;
 
-      if (tempObj->InheritsFrom("TGraphAsymmErrors")) {
+      if (graphs) {
 
-        // find values and errors for each era, and store them in vectors
-        for (int iGraph = 0; iGraph < numPlots; iGraph++) {
-          TGraphAsymmErrors * plot = (TGraphAsymmErrors*)muonInputFile->Get(sf.inputPlots[iGraph].c_str());
-          if(!plot) {
-             clog << "ERROR [ObjectScalingFactorProducer]: Could not find TGraphAsymmErrors: " << sf.inputPlots[iGraph]
-                  << "; will cause a seg fault." << endl;
-             exit(1);
-          }
+        // For each era/graph, find the SF as the product of all muons' SFs
+        valuesByEra.assign(numPlots, 1.0);
+        valuesByEraUp.assign(numPlots, 1.0);
+        valuesByEraDown.assign(numPlots, 1.0);
 
-          // For this era/graph, find the SF as the product of all muons' SFs
-          float thisEraSF = 1.0;
-          float thisEraSFUp = 1.0;
-          float thisEraSFDown = 1.0;
+        for (const auto &muon1 : anatools::selectedObjects (handles_.muons, handles_, "muons")) {
+          // find the points in the TGraphs of all eras for this muon's |eta| at once
+          const vector<pair<double, double> > &eras = graphs->at(abs(muon1.eta()));
 
-          for (const auto &muon1 : *handles_.muons) {
-             // find the point in the TGraph for this muon's |eta|
-             double eta = abs(muon1.eta());
-             int iPoint = 0;
-             while(iPoint < plot->GetN()) {
-               if(eta < plot->GetX()[iPoint] + plot->GetErrorXhigh(iPoint) &&
-                  eta > plot->GetX()[iPoint] - plot->GetErrorXlow(iPoint))
-                  break;
-                else iPoint++;
-             }
-             // if the |eta| is past the highest point, just use the highest \eta| point with a value; |eta| can't be < 0 so no need to check
-             if(iPoint == plot->GetN()) iPoint = plot->GetN() - 1;
-
-             // Now include this muon's scale factor
-             float thisMuonSF = plot->GetY()[iPoint];
-             float thisMuonSFError = plot->GetErrorYhigh(iPoint);
-
-             thisEraSF *= thisMuonSF;
-             thisEraSFUp *= thisMuonSF + thisMuonSFError;
-             thisEraSFDown *= thisMuonSF - thisMuonSFError;
-          } // end loop over muons
-          valuesByEra.push_back(thisEraSF);
-          valuesByEraUp.push_back(thisEraSFUp);
-          valuesByEraDown.push_back(thisEraSFDown);
+          // Now include this muon's scale factor
+          for (int iEra = 0; iEra < numPlots; iEra++) {
+            float thisMuonSF = eras[iEra].first;
+            float thisMuonSFError = eras[iEra].second;
 
-          delete plot;
-        } // end loop over eras
+            valuesByEra[iEra] *= thisMuonSF;
+            valuesByEraUp[iEra] *= thisMuonSF + thisMuonSFError;
+            valuesByEraDown[iEra] *= thisMuonSF - thisMuonSFError;
+          }
+        } // end loop over muons
 
       } // end TGraphAsymmErrors case -- now have vectors of values and errors by era
 
-      else if(tempObj->InheritsFrom("TH2")) {
+      else if((tempObj = muonInputFile->Get(sf.inputPlots[0].c_str())) && tempObj->InheritsFrom("TH2")) {
 
         // find values and errors for each era, and store them in vectors
         for (int iPlot = 0; iPlot < numPlots; iPlot++) {
@@ -222,7 +200,7 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
           float xMax = plot->GetXaxis()->GetBinCenter(plot->GetNbinsX());
           float yMax = plot->GetYaxis()->GetBinCenter(plot->GetNbinsY());
 
-          for (const auto &muon1 : *handles_.muons) {
+          for (const auto &muon1 : anatools::selectedObjects (handles_.muons, handles_, "muons")) {
             float pt = muon1.pt();
             if(pt > xMax) pt = xMax;
             if(pt < xMin) pt = xMin;
@@ -281,7 +259,7 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
 
   if (doElectrons)
     electronInputFile->Close();
-  if (doMuons)
+  if (muonInputFile)
     muonInputFile->Close();
 
   return;
@@ -308,7 +286,7 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
       mc->Scale (1.0 / mc->Integral ());
       data->Divide (mc);
 
-      for (const auto &track : *handles_.tracks)
+      for (const auto &track : anatools::selectedObjects (handles_.tracks, handles_, "tracks"))
         {
           double missingOuterHits = track.hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS);
           sf *= data->GetBinContent (data->FindBin (missingOuterHits));
@@ -323,5 +301,47 @@ ObjectScalingFactorProducer::AddVariables (const edm::Event &event) {
 # endif
 }
 
+void
+ObjectScalingFactorProducer::loadMuonGraphs (TFile *muonInputFile) {
+  // convert the graphs of every muon scale factor given as TGraphAsymmErrors,
+  // so that each event only needs a lookup per muon instead of a linear scan
+  // over the points of each era's graph
+  muonGraphs_.clear();
+  muonHistogramsUsed_ = false;
+  for (const auto &sf : scaleFactors_) {
+    muonGraphs_.emplace_back();
+    if (sf.inputCollection != "muons")
+      continue;
+
+    TObject * tempObj = muonInputFile->Get(sf.inputPlots[0].c_str());
+    if(!tempObj) {
+      clog << "ERROR [ObjectScalingFactorProducer]: Could not find object: " << sf.inputPlots[0]
+           << "; will cause a seg fault." << endl;
+      exit(1);
+    }
+    bool isGraph = tempObj->InheritsFrom("TGraphAsymmErrors");
+    delete tempObj;
+    if (!isGraph) {
+      muonHistogramsUsed_ = true;
+      continue;
+    }
+
+    vector<TGraphAsymmErrors *> graphs;
+    for (const auto &inputPlot : sf.inputPlots) {
+      TGraphAsymmErrors * plot = (TGraphAsymmErrors*)muonInputFile->Get(inputPlot.c_str());
+      if(!plot || !plot->GetN()) {
+        clog << "ERROR [ObjectScalingFactorProducer]: Could not find TGraphAsymmErrors: " << inputPlot
+             << "; will cause a seg fault." << endl;
+        exit(1);
+      }
+      graphs.push_back(plot);
+    }
+    muonGraphs_.back().reset(new GraphSFWeight(graphs));
+    for (auto &plot : graphs)
+      delete plot;
+  }
+  muonGraphsLoaded_ = true;
+}
+
 #include "FWCore/Framework/interface/MakerMacros.h"
 DEFINE_FWK_MODULE(ObjectScalingFactorProducer);
@@ -4,7 +4,9 @@
 #include "OSUT3Analysis/AnaTools/interface/EventVariableProducer.h"
 #include "OSUT3Analysis/AnaTools/interface/DataFormat.h"
 #include "OSUT3Analysis/AnaTools/interface/ValueLookupTree.h"
+#include "OSUT3Analysis/AnaTools/interface/SFWeight.h"
 #include "DataFormats/Math/interface/deltaR.h"
+#include <memory>
 #include <string>
 #include "TH2D.h"
 #include "TH2F.h"
@@ -31,7 +33,16 @@ class ObjectScalingFactorProducer : public EventVariableProducer
         bool doMuSF_;
         bool doTrackSF_;
         void AddVariables(const edm::Event &);
+        void loadMuonGraphs(TFile *);
               vector<ScaleFactor> scaleFactors_;
 
+        // Muon scale factors given as TGraphAsymmErrors, converted on the
+        // first simulated event and indexed like scaleFactors_. The entries of
+        // all other scale factors are NULL. The muon file is only opened for
+        // each event if some muon scale factor is given as a histogram.
+        vector<unique_ptr<GraphSFWeight> > muonGraphs_;
+        bool muonGraphsLoaded_;
+        bool muonHistogramsUsed_;
+
 };
 #endif
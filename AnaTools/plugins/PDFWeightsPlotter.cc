@@ -5,7 +5,9 @@ PDFWeightsPlotter::PDFWeightsPlotter(const edm::ParameterSet &cfg) :
    type_             (cfg.getParameter<string>("type")),
    numPDFWeights_    (cfg.getParameter<uint>("NumPDFWeights")),
    pdfWeightsOffset_ (cfg.getParameter<uint>("PDFWeightsOffset")),
-   firstEvent_       (true)
+   firstEvent_       (true),
+   pdfWeights_       (NULL),
+   pdfWeightSums_    (numPDFWeights_ + 1)
 {
   genInfoProductToken_ = consumes<GenEventInfoProduct> (cfg.getParameter<edm::InputTag> ("GenInfoProduct"));
   lheProductToken_     = consumes<LHEEventProduct> (cfg.getParameter<edm::InputTag> ("LHEProduct"));
@@ -16,7 +18,7 @@ PDFWeightsPlotter::PDFWeightsPlotter(const edm::ParameterSet &cfg) :
     {
       string directoryName = "Generatorweights Plots";
       TFileDirectory subdir = fs_->mkdir(directoryName);
-      subdir.make<TH1D>("PDF Weights", "PDF Weights", numPDFWeights_ + 1, 0, numPDFWeights_ + 1);
+      pdfWeights_ = subdir.make<TH1D>("PDF Weights", "PDF Weights", numPDFWeights_ + 1, 0, numPDFWeights_ + 1);
     }
 }
 PDFWeightsPlotter::~PDFWeightsPlotter() {}
@@ -39,22 +41,31 @@ PDFWeightsPlotter::analyze(const edm::Event &event, const edm::EventSetup &setup
       return;
     }
 
-  double generatorWeightSign = genInfoProduct->weight()/fabs(genInfoProduct->weight());
-  TH1D *pdfweights = fs_->getObject<TH1D>("PDF Weights", "Generatorweights Plots");
+  const vector<gen::WeightsInfo> &weights = lheProduct->weights ();
+  if (weights.empty ())
+    return;
+
+  if (numPDFWeights_ + pdfWeightsOffset_ > weights.size())
+    numPDFWeights_ = (weights.size() > pdfWeightsOffset_) ? weights.size() - pdfWeightsOffset_ : 0;
 
-  if (numPDFWeights_ + pdfWeightsOffset_ > lheProduct->weights().size())
-    numPDFWeights_ = lheProduct->weights().size() - pdfWeightsOffset_;
-  pdfweights->SetBinContent(1, pdfweights->GetBinContent(1) + lheProduct->weights()[0].wgt*generatorWeightSign/lheProduct->originalXWGTUP());
+  double generatorWeightSign = genInfoProduct->weight()/fabs(genInfoProduct->weight());
+  double scale = generatorWeightSign / lheProduct->originalXWGTUP();
 
-  for (uint i = pdfWeightsOffset_; i < numPDFWeights_ + pdfWeightsOffset_; i++) {
-    double oldWeight = pdfweights->GetBinContent(i - pdfWeightsOffset_ + 2);
-    pdfweights->SetBinContent(i - pdfWeightsOffset_ + 2, oldWeight + lheProduct->weights()[i].wgt*generatorWeightSign/lheProduct->originalXWGTUP());
-  }
+  double * const buffer = pdfWeightSums_.buffer ();
+  buffer[0] = weights[0].wgt;
+  for (uint i = 0; i < numPDFWeights_; i++)
+    buffer[i + 1] = weights[i + pdfWeightsOffset_].wgt;
+  pdfWeightSums_.add (buffer, numPDFWeights_ + 1, scale);
 
   firstEvent_ = false;
 #endif
 }
 
+void
+PDFWeightsPlotter::endJob() {
+  pdfWeightSums_.fill (pdfWeights_);
+}
+
 #if DATA_FORMAT_FROM_MINIAOD
 #include "FWCore/Framework/interface/MakerMacros.h"
 DEFINE_FWK_MODULE(PDFWeightsPlotter);
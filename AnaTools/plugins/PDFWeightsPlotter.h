@@ -6,6 +6,7 @@
 #include "FWCore/Framework/interface/EDAnalyzer.h"
 #include "FWCore/ServiceRegistry/interface/Service.h"
 #include "OSUT3Analysis/AnaTools/interface/DataFormat.h"
+#include "OSUT3Analysis/AnaTools/interface/WeightAccumulator.h"
 #include <string>
 #include "TH1D.h"
 #include "TFile.h"
@@ -14,6 +15,7 @@ class PDFWeightsPlotter : public edm::EDAnalyzer
     public:
         PDFWeightsPlotter (const edm::ParameterSet &);
         void analyze (const edm::Event &, const edm::EventSetup &);;
+        void endJob ();
         ~PDFWeightsPlotter ();
         edm::Service<TFileService> fs_;
 
@@ -24,5 +26,10 @@ class PDFWeightsPlotter : public edm::EDAnalyzer
         uint numPDFWeights_;
         uint pdfWeightsOffset_;
         bool firstEvent_;
+
+        // The histogram is only written at endJob; the per-event weights are
+        // summed in pdfWeightSums_, whose first entry is the nominal weight.
+        TH1D *pdfWeights_;
+        WeightAccumulator pdfWeightSums_;
 };
 #endif
@@ -1,4 +1,5 @@
 #include "OSUT3Analysis/AnaTools/interface/CommonUtils.h"
+#include "OSUT3Analysis/AnaTools/interface/SparseHistogram.h"
 #include "OSUT3Analysis/AnaTools/interface/ValueLookupTree.h"
 #include "OSUT3Analysis/AnaTools/plugins/Plotter.h"
 
@@ -21,7 +22,9 @@ Plotter::Plotter (const edm::ParameterSet &cfg) :
   weightDefs_ (cfg.getParameter<vector<edm::ParameterSet> >("weights")),
   histogramSets_ (cfg.getParameter<vector<edm::ParameterSet> >("histogramSets")),
   verbose_ (cfg.getParameter<int> ("verbose")),
-  firstEvent_ (true)
+  firstEvent_ (true),
+  lazyBooking_ (cfg.exists ("lazyBooking") ? cfg.getParameter<bool> ("lazyBooking") : false),
+  sparseHistograms_ (cfg.exists ("sparseHistograms") ? cfg.getParameter<bool> ("sparseHistograms") : false)
 
 {
   if (verbose_) clog << "Beginning Plotter::Plotter constructor." << endl;
@@ -70,34 +73,33 @@ Plotter::Plotter (const edm::ParameterSet &cfg) :
 
   } // end loop on histogram sets
 
+  //////////////////////////////////
+  // parse the weight definitions //
+  //////////////////////////////////
+
+  // the nominal weights are filled into the histograms in this module's own
+  // directory, and each variation into a copy of them in its own top-level
+  // directory
+  weightSets_.push_back(parseWeightDefs(weightDefs_));
+  weightSetDirectories_.push_back("");
+  if (cfg.exists ("weightVariations")){
+    vector<edm::ParameterSet> weightVariations = cfg.getParameter<vector<edm::ParameterSet> >("weightVariations");
+    for(unsigned weightVariation = 0; weightVariation != weightVariations.size(); weightVariation++){
+      weightSets_.push_back(parseWeightDefs(weightVariations.at(weightVariation).getParameter<vector<edm::ParameterSet> >("weights")));
+      weightSetDirectories_.push_back(weightVariations.at(weightVariation).getParameter<string>("directory"));
+    }
+  }
+  weightProducts_.resize(weightSets_.size(), 1.0);
+
   // loop over each parsed histogram configuration
   vector<HistoDef>::iterator histogram;
   for(histogram = histogramDefinitions.begin(); histogram != histogramDefinitions.end(); ++histogram){
 
-    // book a TH1/TH2 in the appropriate folder
+    // book a TH1/TH2 in the appropriate folder, or prepare to do so later
     bookHistogram(*histogram);
 
   } // end loop on parsed histograms
 
-  //////////////////////////////////
-  // parse the weight definitions //
-  //////////////////////////////////
-
-  for(unsigned weightDef = 0; weightDef != weightDefs_.size(); weightDef++){
-    vector<string> inputCollections = weightDefs_.at(weightDef).getParameter<vector<string> > ("inputCollections");
-    vector<string>::iterator inputCollection;
-    for(inputCollection = inputCollections.begin(); inputCollection != inputCollections.end(); ++inputCollection){
-      objectsToGet_.insert(*inputCollection);
-    }
-    string inputVariable = weightDefs_.at(weightDef).getParameter<string> ("inputVariable");
-    Weight weight;
-    weight.inputCollections = inputCollections;
-    weight.inputVariable = inputVariable;
-    weight.valueLookupTree = NULL;
-    weight.product = 1.0;
-    weights.push_back(weight);
-  }
-
   anatools::getAllTokens (collections_, consumesCollector (), tokens_);
 }
 
@@ -137,6 +139,14 @@ Plotter::analyze (const edm::Event &event, const edm::EventSetup &setup)
       }
     }
 
+  // then the product of the weights in each weight set
+  for (unsigned weightSet = 0; weightSet < weightSets_.size (); weightSet++)
+    {
+      weightProducts_.at (weightSet) = 1.0;
+      for (vector<unsigned>::const_iterator index = weightSets_.at (weightSet).begin (); index != weightSets_.at (weightSet).end (); index++)
+        weightProducts_.at (weightSet) *= weights.at (*index).product;
+    }
+
   // now we'll loop over the histograms, filling each one as we go
 
   vector<HistoDef>::iterator histogram;
@@ -148,12 +158,71 @@ Plotter::analyze (const edm::Event &event, const edm::EventSetup &setup)
 
 ////////////////////////////////////////////////////////////////////////
 
+void
+Plotter::endJob ()
+{
+  // With eager booking, TFileService writes the histograms when it closes the
+  // output file, in the order in which they were booked, i.e., the configured
+  // order. Otherwise, the histograms which were never filled with lazy
+  // booking, and those which were filled sparsely, are only booked now. Each
+  // is written to the output file and deleted as soon as it is filled, so that
+  // only one of them is held in memory at a time. The histograms which were
+  // already booked are written and deleted along with them, so that the keys
+  // in each directory are still in the configured order.
+  bool bookedInEndJob = lazyBooking_;
+  for (const auto &definition : histogramDefinitions)
+    bookedInEndJob = bookedInEndJob || !definition.sparseHistograms.empty ();
+  if (!bookedInEndJob)
+    return;
+
+  for (auto &definition : histogramDefinitions)
+    {
+      for (auto &histogram : definition.histograms)
+        {
+          histogram->GetDirectory ()->WriteTObject (histogram);
+          histogram->SetDirectory (NULL);
+          delete histogram;
+        }
+      definition.histograms.clear ();
+
+      if (!definition.lazy && definition.sparseHistograms.empty ())
+        continue;
+
+      TH1 *histogram = makeHistogram (definition);
+      if (histogram)
+        {
+          TDirectory *nominalDirectory = histogram->GetDirectory ();
+          for (unsigned weightSet = 0; weightSet < weightSets_.size (); weightSet++)
+            {
+              TDirectory *directory = nominalDirectory;
+              if (weightSet)
+                directory = getDirectory (getDirectory (&fs_->file (), weightSetDirectories_.at (weightSet)), definition.directory);
+
+              histogram->Reset ();
+              if (!definition.sparseHistograms.empty ())
+                definition.sparseHistograms.at (weightSet)->fill (histogram);
+              directory->WriteTObject (histogram);
+            }
+          delete histogram;
+        }
+
+      definition.lazy = false;
+      for (auto &sparseHistogram : definition.sparseHistograms)
+        delete sparseHistogram;
+      definition.sparseHistograms.clear ();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+
 Plotter::~Plotter ()
 {
   for (auto &histogram : histogramDefinitions)
     {
       for (auto &valueLookupTree : histogram.valueLookupTrees)
         delete valueLookupTree;
+      for (auto &sparseHistogram : histogram.sparseHistograms)
+        delete sparseHistogram;
     }
 
   for (auto &weight : weights)
@@ -203,6 +272,8 @@ HistoDef Plotter::parseHistoDef(const edm::ParameterSet &definition, const vecto
   parsedDef.inputVariables = definition.getParameter<vector<string> >("inputVariables");
   parsedDef.dimensions = parsedDef.inputVariables.size();
   parsedDef.weight = definition.getUntrackedParameter<bool>("weight", true);
+  parsedDef.lazy = false;
+  parsedDef.sparse = definition.getUntrackedParameter<bool>("sparse", sparseHistograms_);
 
   // for 1D histograms, set the appropriate y-axis label
   parsedDef.title = setYaxisLabel(parsedDef);
@@ -213,8 +284,52 @@ HistoDef Plotter::parseHistoDef(const edm::ParameterSet &definition, const vecto
 
 ////////////////////////////////////////////////////////////////////////
 
+// parses a list of weight definitions and returns the indices of its weights,
+// adding those which have not been seen before to the list of weights
+vector<unsigned> Plotter::parseWeightDefs(const vector<edm::ParameterSet> &weightDefs){
+
+  vector<unsigned> weightSet;
+
+  for(unsigned weightDef = 0; weightDef != weightDefs.size(); weightDef++){
+    vector<string> inputCollections = weightDefs.at(weightDef).getParameter<vector<string> > ("inputCollections");
+    vector<string>::iterator inputCollection;
+    for(inputCollection = inputCollections.begin(); inputCollection != inputCollections.end(); ++inputCollection){
+      objectsToGet_.insert(*inputCollection);
+    }
+    string inputVariable = weightDefs.at(weightDef).getParameter<string> ("inputVariable");
+
+    unsigned index = 0;
+    while (index != weights.size() && (weights.at(index).inputVariable != inputVariable || weights.at(index).inputCollections != inputCollections))
+      index++;
+    if (index == weights.size()){
+      Weight weight;
+      weight.inputCollections = inputCollections;
+      weight.inputVariable = inputVariable;
+      weight.valueLookupTree = NULL;
+      weight.product = 1.0;
+      weights.push_back(weight);
+    }
+    weightSet.push_back(index);
+  }
+
+  return weightSet;
+
+}
+
+////////////////////////////////////////////////////////////////////////
+
+// returns the subdirectory of parent with the given name, creating it if needed
+TDirectory *Plotter::getDirectory(TDirectory * const parent, const string &name){
+
+  TDirectory *directory = parent->GetDirectory(name.c_str());
+  return directory ? directory : parent->mkdir(name.c_str());
+
+}
+
+////////////////////////////////////////////////////////////////////////
+
 // book TH1 or TH2 in appropriate directory with correct bin options
-void Plotter::bookHistogram(const HistoDef &definition){
+void Plotter::bookHistogram(HistoDef &definition){
 
   // check for valid bins
   bool hasValidBinsX = definition.binsX.size() >= 3;
@@ -234,13 +349,74 @@ void Plotter::bookHistogram(const HistoDef &definition){
     return;
   }
 
+  // make the directories now, so that they are in the configured order in
+  // the output file however the histograms are booked
+  fs_->mkdir(definition.directory);
+  for(unsigned weightSet = 1; weightSet < weightSets_.size(); weightSet++)
+    getDirectory(getDirectory(&fs_->file(), weightSetDirectories_.at(weightSet)), definition.directory);
+
+  // 2D and 3D histograms may be filled into sparse histograms instead, and
+  // any histogram may be booked on its first fill; either way, endJob books
+  // whatever has not been booked yet
+  if(definition.sparse && (definition.dimensions == 2 || definition.dimensions == 3)){
+    // TH3D objects only support variable bins along all three axes or along
+    // none, so the same axes are made here
+    bool variableBins = definition.dimensions == 3 && (definition.hasVariableBinsX || definition.hasVariableBinsY || definition.hasVariableBinsZ);
+    auto makeAxis = [&] (const vector<double> &bins, const bool hasVariableBins) {
+      return (hasVariableBins || variableBins) ? TAxis(bins.size() - 1, bins.data()) : TAxis(bins.at(0), bins.at(1), bins.at(2));
+    };
+    TAxis axisX = makeAxis(definition.binsX, definition.hasVariableBinsX);
+    TAxis axisY = makeAxis(definition.binsY, definition.hasVariableBinsY);
+    for(unsigned weightSet = 0; weightSet < weightSets_.size(); weightSet++){
+      if(definition.dimensions == 2)
+        definition.sparseHistograms.push_back(new SparseHistogram(axisX, axisY));
+      else
+        definition.sparseHistograms.push_back(new SparseHistogram(axisX, axisY, makeAxis(definition.binsZ, definition.hasVariableBinsZ)));
+    }
+    return;
+  }
+  if(lazyBooking_){
+    definition.lazy = true;
+    return;
+  }
+
+  bookDenseHistograms(definition);
+
+}
+
+////////////////////////////////////////////////////////////////////////
+
+// book the nominal histogram and a copy of it for each weight variation
+void Plotter::bookDenseHistograms(HistoDef &definition){
+
+  definition.lazy = false;
+
+  // keep a pointer to the nominal histogram, and book a copy of it for each
+  // weight variation
+  TH1 *nominal = makeHistogram(definition);
+  if(!nominal)
+    return;
+  definition.histograms.push_back(nominal);
+  for(unsigned weightSet = 1; weightSet < weightSets_.size(); weightSet++){
+    TH1 *variation = (TH1 *) nominal->Clone();
+    variation->SetDirectory(getDirectory(getDirectory(&fs_->file(), weightSetDirectories_.at(weightSet)), definition.directory));
+    definition.histograms.push_back(variation);
+  }
+
+}
+
+////////////////////////////////////////////////////////////////////////
+
+// make the TH1, TH2 or TH3 of a definition in its directory of the output file
+TH1 *Plotter::makeHistogram(const HistoDef &definition){
+
   TFileDirectory subdir = fs_->mkdir(definition.directory);
 
   // book 1D histogram
   if(definition.dimensions == 1){
     // equal X bins
     if(!definition.hasVariableBinsX){
-      subdir.make<TH1D>(TString(definition.name),
+      return subdir.make<TH1D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.at(0),
                         definition.binsX.at(1),
@@ -248,7 +424,7 @@ void Plotter::bookHistogram(const HistoDef &definition){
     }
     // variable X bins
     else{
-      subdir.make<TH1D>(TString(definition.name),
+      return subdir.make<TH1D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.size() - 1,
                         definition.binsX.data());
@@ -258,7 +434,7 @@ void Plotter::bookHistogram(const HistoDef &definition){
   else if(definition.dimensions == 2){
     // equal X bins and equal Y bins
     if(!definition.hasVariableBinsX && !definition.hasVariableBinsY){
-      subdir.make<TH2D>(TString(definition.name),
+      return subdir.make<TH2D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.at(0),
                         definition.binsX.at(1),
@@ -269,7 +445,7 @@ void Plotter::bookHistogram(const HistoDef &definition){
     }
     // variable X bins and equal Y bins
     else if(definition.hasVariableBinsX && !definition.hasVariableBinsY){
-      subdir.make<TH2D>(TString(definition.name),
+      return subdir.make<TH2D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.size() - 1,
                         definition.binsX.data(),
@@ -279,7 +455,7 @@ void Plotter::bookHistogram(const HistoDef &definition){
     }
     // equal X bins and variable Y bins
     else if(!definition.hasVariableBinsX && definition.hasVariableBinsY){
-      subdir.make<TH2D>(TString(definition.name),
+      return subdir.make<TH2D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.at(0),
                         definition.binsX.at(1),
@@ -289,7 +465,7 @@ void Plotter::bookHistogram(const HistoDef &definition){
     }
     // variable X bins and variable Y bins
     else if(definition.hasVariableBinsX && definition.hasVariableBinsY){
-      subdir.make<TH2D>(TString(definition.name),
+      return subdir.make<TH2D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.size() - 1,
                         definition.binsX.data(),
@@ -300,7 +476,7 @@ void Plotter::bookHistogram(const HistoDef &definition){
   else if(definition.dimensions == 3){
     // equal X bins, equal Y bins, and equal Z bins
     if(!definition.hasVariableBinsX && !definition.hasVariableBinsY && !definition.hasVariableBinsZ){
-      subdir.make<TH3D>(TString(definition.name),
+      return subdir.make<TH3D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.at(0),
                         definition.binsX.at(1),
@@ -315,7 +491,7 @@ void Plotter::bookHistogram(const HistoDef &definition){
     // variable X bins, variable Y bins, and variable Z bins
     // TH3D objects only support variable bins along all three axes or along none
     else{
-      subdir.make<TH3D>(TString(definition.name),
+      return subdir.make<TH3D>(TString(definition.name),
                         TString(definition.title),
                         definition.binsX.size() - 1,
                         definition.binsX.data(),
@@ -327,15 +503,16 @@ void Plotter::bookHistogram(const HistoDef &definition){
   }
   else{
     cout << "WARNING - invalid histogram dimension" << endl;
-    return;
   }
 
+  return NULL;
+
 }
 
 ////////////////////////////////////////////////////////////////////////
 
 // fill TH1 or TH2 using one collection
-void Plotter::fillHistogram(const HistoDef &definition){
+void Plotter::fillHistogram(HistoDef &definition){
 
  if(definition.dimensions == 1){
    fill1DHistogram(definition);
@@ -355,9 +532,10 @@ void Plotter::fillHistogram(const HistoDef &definition){
 ////////////////////////////////////////////////////////////////////////
 
 // fill TH1 using one collection
-void Plotter::fill1DHistogram(const HistoDef &definition){
+void Plotter::fill1DHistogram(HistoDef &definition){
 
-  TH1D *histogram = fs_->getObject<TH1D>(definition.name, definition.directory);
+  if(definition.histograms.empty() && !definition.lazy)
+    return;
 
   // loop over objects in input collection and fill histogram
   for(vector<Leaf>::const_iterator leaf = definition.valueLookupTrees.at (0)->evaluate ().begin (); leaf != definition.valueLookupTrees.at (0)->evaluate ().end (); leaf++){
@@ -368,15 +546,17 @@ void Plotter::fill1DHistogram(const HistoDef &definition){
 
     if(IS_INVALID(value))
       continue;
+    if(definition.lazy)
+      bookDenseHistograms(definition);
+    TH1D *histogram = (TH1D *) definition.histograms.at(0);
     if(definition.hasVariableBinsX){
       weight /= getBinSize(histogram,value);
     }
     if (handles_.generatorweights.isValid ())
       weight *= anatools::getGeneratorWeight (*handles_.generatorweights);
-    for (vector<Weight>::iterator sf = weights.begin (); sf != weights.end (); sf++)
-      weight *= sf->product;
-    histogram->Fill(value, (definition.weight ? weight : 1.0));
-    if (verbose_) clog << "Filled histogram " << definition.name << " with value=" << value << ", weight=" << weight << endl;
+    for(unsigned weightSet = 0; weightSet < definition.histograms.size(); weightSet++)
+      definition.histograms.at(weightSet)->Fill(value, (definition.weight ? weight * weightProducts_.at(weightSet) : 1.0));
+    if (verbose_) clog << "Filled histogram " << definition.name << " with value=" << value << ", weight=" << weight * weightProducts_.at(0) << endl;
 
   }
 
@@ -385,11 +565,10 @@ void Plotter::fill1DHistogram(const HistoDef &definition){
 ////////////////////////////////////////////////////////////////////////
 
 // fill TH2 using one collection
-void Plotter::fill2DHistogram(const HistoDef &definition){
+void Plotter::fill2DHistogram(HistoDef &definition){
 
+  // the products of the weights are applied per weight set when filling
   double weight = 1.0;
-  for (vector<Weight>::iterator sf = weights.begin (); sf != weights.end (); sf++)
-    weight *= sf->product;
 
 
   // if there's a single input collection used on both axes
@@ -434,37 +613,47 @@ void Plotter::fill2DHistogram(const HistoDef &definition){
 
 ////////////////////////////////////////////////////////////////////////
 
-void Plotter::fill2DHistogram(const HistoDef & definition, double valueX, double valueY, double weight) {
+void Plotter::fill2DHistogram(HistoDef & definition, double valueX, double valueY, double weight) {
 
-  TH2D *histogram = fs_->getObject<TH2D>(definition.name, definition.directory);
-  if (!histogram) {
+  if(IS_INVALID(valueX) || IS_INVALID(valueY))
+    return;
+  if(definition.lazy)
+    bookDenseHistograms(definition);
+  TH2D *histogram = definition.histograms.empty() ? NULL : (TH2D *) definition.histograms.at(0);
+  SparseHistogram *sparseHistogram = definition.sparseHistograms.empty() ? NULL : definition.sparseHistograms.at(0);
+  if (!histogram && !sparseHistogram) {
     clog << "ERROR [Plotter::fill2DHistogram]:  Could not find histogram with name " << definition.name
          << " in directory " << definition.directory << endl;
     return;
   }
-  if(IS_INVALID(valueX) || IS_INVALID(valueY))
-    return;
-  if(definition.hasVariableBinsX){
-    weight /= getBinSize(histogram,valueX,valueY).first;
-  }
-  if(definition.hasVariableBinsY){
-    weight /= getBinSize(histogram,valueX,valueY).second;
+  if(definition.hasVariableBinsX || definition.hasVariableBinsY){
+    pair<double,double> binSize = sparseHistogram ? getBinSize(sparseHistogram,valueX,valueY) : getBinSize(histogram,valueX,valueY);
+    if(definition.hasVariableBinsX)
+      weight /= binSize.first;
+    if(definition.hasVariableBinsY)
+      weight /= binSize.second;
   }
   if (handles_.generatorweights.isValid ())
     weight *= anatools::getGeneratorWeight (*handles_.generatorweights);
-  histogram->Fill(valueX, valueY, (definition.weight ? weight : 1.0));
-  if (verbose_) clog << "Filled histogram " << definition.name << " with valueX=" << valueX << ", valueY=" << valueY << ", weight=" << weight << endl;
+  if(sparseHistogram){
+    for(unsigned weightSet = 0; weightSet < definition.sparseHistograms.size(); weightSet++)
+      definition.sparseHistograms.at(weightSet)->Fill(valueX, valueY, (definition.weight ? weight * weightProducts_.at(weightSet) : 1.0));
+  }
+  else{
+    for(unsigned weightSet = 0; weightSet < definition.histograms.size(); weightSet++)
+      ((TH2D *) definition.histograms.at(weightSet))->Fill(valueX, valueY, (definition.weight ? weight * weightProducts_.at(weightSet) : 1.0));
+  }
+  if (verbose_) clog << "Filled histogram " << definition.name << " with valueX=" << valueX << ", valueY=" << valueY << ", weight=" << weight * weightProducts_.at(0) << endl;
 
 }
 
 ////////////////////////////////////////////////////////////////////////
 
 // fill TH3 using one collection
-void Plotter::fill3DHistogram(const HistoDef &definition){
+void Plotter::fill3DHistogram(HistoDef &definition){
 
+  // the products of the weights are applied per weight set when filling
   double weight = 1.0;
-  for (vector<Weight>::iterator sf = weights.begin (); sf != weights.end (); sf++)
-    weight *= sf->product;
 
   // if there's a single input collection used on all axes
   // and no specific object is chosen from that collection,
@@ -516,29 +705,39 @@ void Plotter::fill3DHistogram(const HistoDef &definition){
 
 ////////////////////////////////////////////////////////////////////////
 
-void Plotter::fill3DHistogram(const HistoDef & definition, double valueX, double valueY, double valueZ, double weight) {
+void Plotter::fill3DHistogram(HistoDef & definition, double valueX, double valueY, double valueZ, double weight) {
 
-  TH3D *histogram = fs_->getObject<TH3D>(definition.name, definition.directory);
-  if (!histogram) {
-    clog << "ERROR [Plotter::fill2DHistogram]:  Could not find histogram with name " << definition.name
-         << " in directory " << definition.directory << endl;
-    return;
-  }
   if(IS_INVALID(valueX) || IS_INVALID(valueY) || IS_INVALID(valueZ))
     return;
-  if(definition.hasVariableBinsX){
-    weight /= get<0> (getBinSize(histogram,valueX,valueY,valueZ));
-  }
-  if(definition.hasVariableBinsY){
-    weight /= get<1> (getBinSize(histogram,valueX,valueY,valueZ));
+  if(definition.lazy)
+    bookDenseHistograms(definition);
+  TH3D *histogram = definition.histograms.empty() ? NULL : (TH3D *) definition.histograms.at(0);
+  SparseHistogram *sparseHistogram = definition.sparseHistograms.empty() ? NULL : definition.sparseHistograms.at(0);
+  if (!histogram && !sparseHistogram) {
+    clog << "ERROR [Plotter::fill3DHistogram]:  Could not find histogram with name " << definition.name
+         << " in directory " << definition.directory << endl;
+    return;
   }
-  if(definition.hasVariableBinsZ){
-    weight /= get<2> (getBinSize(histogram,valueX,valueY,valueZ));
+  if(definition.hasVariableBinsX || definition.hasVariableBinsY || definition.hasVariableBinsZ){
+    tuple<double,double,double> binSize = sparseHistogram ? getBinSize(sparseHistogram,valueX,valueY,valueZ) : getBinSize(histogram,valueX,valueY,valueZ);
+    if(definition.hasVariableBinsX)
+      weight /= get<0> (binSize);
+    if(definition.hasVariableBinsY)
+      weight /= get<1> (binSize);
+    if(definition.hasVariableBinsZ)
+      weight /= get<2> (binSize);
   }
   if (handles_.generatorweights.isValid ())
     weight *= anatools::getGeneratorWeight (*handles_.generatorweights);
-  histogram->Fill(valueX, valueY, valueZ, (definition.weight ? weight : 1.0));
-  if (verbose_) clog << "Filled histogram " << definition.name << " with valueX=" << valueX << ", valueY=" << valueY << ", valueZ=" << valueZ << ", weight=" << weight << endl;
+  if(sparseHistogram){
+    for(unsigned weightSet = 0; weightSet < definition.sparseHistograms.size(); weightSet++)
+      definition.sparseHistograms.at(weightSet)->Fill(valueX, valueY, valueZ, (definition.weight ? weight * weightProducts_.at(weightSet) : 1.0));
+  }
+  else{
+    for(unsigned weightSet = 0; weightSet < definition.histograms.size(); weightSet++)
+      ((TH3D *) definition.histograms.at(weightSet))->Fill(valueX, valueY, valueZ, (definition.weight ? weight * weightProducts_.at(weightSet) : 1.0));
+  }
+  if (verbose_) clog << "Filled histogram " << definition.name << " with valueX=" << valueX << ", valueY=" << valueY << ", valueZ=" << valueZ << ", weight=" << weight * weightProducts_.at(0) << endl;
 
 }
 
@@ -555,9 +754,11 @@ double Plotter::getBinSize(TH1D * const histogram,
 
 }
 
-pair<double,double>  Plotter::getBinSize(TH2D * const histogram,
-                                         const double valueX,
-                                         const double valueY){
+// also used for the SparseHistogram objects, which number their bins the same
+// way
+template<class T> pair<double,double>  Plotter::getBinSize(T * const histogram,
+                                                           const double valueX,
+                                                           const double valueY){
 
   int binIndex = histogram->FindBin(valueX, valueY);
   double binSizeX = histogram->GetXaxis()->GetBinWidth(binIndex);
@@ -567,10 +768,10 @@ pair<double,double>  Plotter::getBinSize(TH2D * const histogram,
 
 }
 
-tuple<double,double,double>  Plotter::getBinSize(TH3D * const histogram,
-                                                 const double valueX,
-                                                 const double valueY,
-                                                 const double valueZ){
+template<class T> tuple<double,double,double>  Plotter::getBinSize(T * const histogram,
+                                                                   const double valueX,
+                                                                   const double valueY,
+                                                                   const double valueZ){
 
   int binIndex = histogram->FindBin(valueX, valueY, valueZ);
   double binSizeX = histogram->GetXaxis()->GetBinWidth(binIndex);
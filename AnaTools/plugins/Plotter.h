@@ -13,6 +13,7 @@
 
 #include "OSUT3Analysis/AnaTools/interface/AnalysisTypes.h"
 
+#include "TDirectory.h"
 #include "TH1.h"
 #include "TH2.h"
 #include "TH3.h"
@@ -24,6 +25,7 @@ class Plotter : public edm::EDAnalyzer
       Plotter (const edm::ParameterSet &);
       ~Plotter ();
       void analyze(const edm::Event&, const edm::EventSetup&);
+      void endJob();
 
     private:
 
@@ -33,6 +35,14 @@ class Plotter : public edm::EDAnalyzer
       int verbose_;
       bool firstEvent_;
 
+      // If lazyBooking is set, the histograms are only booked when they are
+      // first filled. If sparseHistograms is set, or the "sparse" parameter
+      // of a definition, the 2D and 3D histograms are filled into a
+      // SparseHistogram instead. Either way, the histograms are written as
+      // ordinary TH1D, TH2D and TH3D objects at the end of the job.
+      bool lazyBooking_;
+      bool sparseHistograms_;
+
       //Collections
       Collections handles_;
       Tokens tokens_;
@@ -48,22 +58,35 @@ class Plotter : public edm::EDAnalyzer
 
       vector<HistoDef> histogramDefinitions;
 
+      // Every distinct weight used by the nominal weight set or any of the
+      // variations, each of which is evaluated only once per event.
       vector<Weight> weights;
 
+      // For each weight set, with the nominal set first, the indices of its
+      // weights, the top-level directory of its histograms, and the product
+      // of its weights in the current event.
+      vector<vector<unsigned> > weightSets_;
+      vector<string> weightSetDirectories_;
+      vector<double> weightProducts_;
+
       string getDirectoryName(const string);
       HistoDef parseHistoDef(const edm::ParameterSet &, const vector<string> &, const string &, const string &);
-      void bookHistogram(const HistoDef &);
-
-      void fillHistogram(const HistoDef &);
-      void fill1DHistogram(const HistoDef &);
-      void fill2DHistogram(const HistoDef &);
-      void fill2DHistogram(const HistoDef & definition, double valueX, double valueY, double weight);
-      void fill3DHistogram(const HistoDef &);
-      void fill3DHistogram(const HistoDef & definition, double valueX, double valueY, double valueZ, double weight);
+      vector<unsigned> parseWeightDefs(const vector<edm::ParameterSet> &);
+      void bookHistogram(HistoDef &);
+      void bookDenseHistograms(HistoDef &);
+      TH1 *makeHistogram(const HistoDef &);
+      TDirectory *getDirectory(TDirectory * const, const string &);
+
+      void fillHistogram(HistoDef &);
+      void fill1DHistogram(HistoDef &);
+      void fill2DHistogram(HistoDef &);
+      void fill2DHistogram(HistoDef & definition, double valueX, double valueY, double weight);
+      void fill3DHistogram(HistoDef &);
+      void fill3DHistogram(HistoDef & definition, double valueX, double valueY, double valueZ, double weight);
 
       double getBinSize(TH1D * const, const double);
-      pair<double,double> getBinSize(TH2D * const, const double, const double);
-      tuple<double,double,double>  getBinSize(TH3D * const, const double, const double, const double);
+      template<class T> pair<double,double> getBinSize(T * const, const double, const double);
+      template<class T> tuple<double,double,double>  getBinSize(T * const, const double, const double, const double);
       string setYaxisLabel(const HistoDef &);
 
 
@@ -40,7 +40,9 @@ TriggerEfficiencyAnalyzer::TriggerEfficiencyAnalyzer (const edm::ParameterSet &c
     TriggerHistEffMap  [*triggerType]->GetXaxis()->SetBinLabel (nTriggers+2,"OR of All Triggers");
     effName.ReplaceAll("Eff", " trigger efficiency");
     TriggerHistEffMap  [*triggerType]->SetTitle(effName);
+    triggerHistograms_.push_back(TriggerHistogramMap[*triggerType]);
   }
+  inclusiveOR_.resize(TriggerTypes.size(), false);
 
   TriggerToken_ = consumes<edm::TriggerResults> (Trigger_);
 }
@@ -78,40 +80,37 @@ TriggerEfficiencyAnalyzer::analyze (const edm::Event &event, const edm::EventSet
   event.getByToken (TriggerToken_ , TriggerCollection);
   const edm::TriggerNames &triggerNames = event.triggerNames(*TriggerCollection);
 
-  //initialize maps
-  for(std::vector<string>::const_iterator triggerType = TriggerTypes.begin(); triggerType != TriggerTypes.end(); triggerType++){
-    InclusiveORMap[*triggerType] = false;
+  //find the trigger paths matching each trigger name, once per trigger menu
+  if (triggerNamesPSetID_ != triggerNames.parameterSetID ()) {
+    triggerNamesPSetID_ = triggerNames.parameterSetID ();
+    triggerBins_.clear ();
+    for (unsigned triggerIndex = 0; triggerIndex < triggerNames.size (); triggerIndex++){
+      const string &name = triggerNames.triggerName(triggerIndex);
+      for (unsigned typeIndex = 0; typeIndex < TriggerTypes.size (); typeIndex++){
+        const vector<string> &names = TriggerNameMap[TriggerTypes.at(typeIndex)];
+        for (unsigned nameIndex = 0; nameIndex < names.size (); nameIndex++)
+          if (name.find(names.at(nameIndex)) != std::string::npos)
+            triggerBins_.push_back ({triggerIndex, typeIndex, nameIndex + 1.0});
+      }
+    }
   }
 
-  int nEvts = 0;
   //fill denominator bin for all trigger types that match generated final state
-  for(std::vector<string>::const_iterator triggerType = TriggerTypes.begin(); triggerType != TriggerTypes.end(); triggerType++) {
-    TriggerHistogramMap[*triggerType]->Fill(0) ;
-    nEvts++;
+  for (unsigned typeIndex = 0; typeIndex < triggerHistograms_.size (); typeIndex++){
+    triggerHistograms_.at(typeIndex)->Fill(0);
+    inclusiveOR_.at(typeIndex) = false;
   }
 
-
-  //loop over all trigger paths in the event
-  for (unsigned triggerIndex = 0; triggerIndex < triggerNames.size (); triggerIndex++){
-    string name = triggerNames.triggerName(triggerIndex);
-    bool pass = TriggerCollection->accept(triggerIndex);
-    if(pass != 1) continue;
-
-    //loop over the different types of triggers of interest
-    for(std::vector<string>::const_iterator triggerType = TriggerTypes.begin(); triggerType != TriggerTypes.end(); triggerType++){
-      //loop over the different trigger names as specified by the user
-      for(std::vector<string>::const_iterator triggerName = TriggerNameMap[*triggerType].begin(); triggerName != TriggerNameMap[*triggerType].end(); triggerName++){
-        if(name.find(*triggerName)!=std::string::npos){
-          //          cout << name << "  " << *triggerName << " " << name.find(*triggerName) << endl;
-          TriggerHistogramMap[*triggerType]->Fill(triggerName-TriggerNameMap[*triggerType].begin()+1);
-          InclusiveORMap[*triggerType] = true;
-        }
-      }
-    }
+  //fill the bin of each matching trigger path which the event passed
+  for (const auto &triggerBin : triggerBins_){
+    if (!TriggerCollection->accept(triggerBin.triggerIndex)) continue;
+    triggerHistograms_.at(triggerBin.typeIndex)->Fill(triggerBin.bin);
+    inclusiveOR_.at(triggerBin.typeIndex) = true;
   }
+
   //fill final bin if any triggers were passed
-  for(std::vector<string>::const_iterator triggerType = TriggerTypes.begin(); triggerType != TriggerTypes.end(); triggerType++)
-    if(InclusiveORMap[*triggerType]) TriggerHistogramMap[*triggerType]->Fill(TriggerNameMap[*triggerType].size()+1);
+  for (unsigned typeIndex = 0; typeIndex < triggerHistograms_.size (); typeIndex++)
+    if (inclusiveOR_.at(typeIndex)) triggerHistograms_.at(typeIndex)->Fill(triggerHistograms_.at(typeIndex)->GetNbinsX()-1);
 
 } // void TriggerEfficiencyAnalyzer::analyze (const edm::Event &event, const edm::EventSetup &setup)
 
@@ -32,7 +32,6 @@ class TriggerEfficiencyAnalyzer : public edm::EDAnalyzer
       std::map< string, std::vector<string> > TriggerNameMap;
       std::map< string, TH1D* > TriggerHistogramMap;
       std::map< string, TH1D* > TriggerHistEffMap;
-      std::map< string, bool > InclusiveORMap;
 
       void analyze (const edm::Event &, const edm::EventSetup &);
       const edm::Service<TFileService> fs;
@@ -44,6 +43,22 @@ class TriggerEfficiencyAnalyzer : public edm::EDAnalyzer
       vector<edm::ParameterSet> triggers_;
       TStopwatch* timer;
 
+      // A trigger path in the menu matching one of the trigger names of a
+      // trigger type, and the bin of that type's histogram to fill when it
+      // fires. They are found once per trigger menu.
+      struct TriggerBin
+      {
+        unsigned  triggerIndex;
+        unsigned  typeIndex;
+        double    bin;
+      };
+      edm::ParameterSetID triggerNamesPSetID_;
+      vector<TriggerBin> triggerBins_;
+
+      // The histogram of each trigger type, in the order of TriggerTypes.
+      vector<TH1D *> triggerHistograms_;
+      vector<bool> inclusiveOR_;
+
   };
 
 #endif
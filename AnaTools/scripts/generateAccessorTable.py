@@ -0,0 +1,219 @@
+#!/usr/bin/env python
+
+# Generates AnaTools/src/AccessorTable.cc, the table of compiled accessors which
+# anatools::getMember consults before falling back to reflection.
+#
+# The osu:: classes with dictionaries are taken from Collections/src/classes_def.xml
+# and their public members returning arithmetic types from the headers in
+# Collections/interface, including those inherited from other osu:: classes.
+# The members inherited from the CMSSW classes are not parsed; a fixed list of
+# commonly used ones is tried for every class instead. Each entry is only
+# registered if it compiles for the data format in use, so the table does not
+# need to be regenerated when switching formats, only when the headers change.
+#
+# With '-c', nothing is written; the script instead exits with a non-zero status
+# if the table in the package differs from the one it would write. This is run
+# by githooks/pre-commit.d/accessorTableCheck.sh.
+
+import os
+import re
+import sys
+import fnmatch
+from StringIO import StringIO
+from optparse import OptionParser
+
+# Members of the CMSSW classes underlying the osu:: classes, e.g., those of
+# reco::Candidate, reco::Track and the pat:: objects, which are tried for every
+# class.
+baseMembers = [
+    "BeamWidthX", "BeamWidthY", "caloIso", "charge", "chargedEmEnergyFraction",
+    "chargedHadronEnergyFraction", "chargedHadronIso", "chargedMultiplicity",
+    "chi2", "d0", "dB", "deltaEtaSuperClusterTrackAtVtx",
+    "deltaPhiSuperClusterTrackAtVtx", "dxy", "dz", "eSuperClusterOverP",
+    "ecalEnergy", "ecalIso", "edB", "energy", "et", "eta", "etaWidth",
+    "full5x5_sigmaIetaIeta", "getBunchCrossing", "getPU_NumInteractions",
+    "getTrueNumInteractions", "hadTowOverEm", "hadronFlavour", "hadronicOverEm",
+    "hcalIso", "isEB", "isEBEEGap", "isEE", "isElectron", "isFake", "isGap",
+    "isGlobalMuon", "isJet", "isLooseMuon", "isMuon", "isPFMuon", "isPhoton",
+    "isStandAloneMuon", "isTrackerMuon", "isValid", "jetArea", "mass", "mt",
+    "muonEnergyFraction", "ndof", "neutralEmEnergyFraction",
+    "neutralHadronEnergyFraction", "neutralHadronIso", "neutralMultiplicity",
+    "normalizedChi2", "numberOfChambers", "numberOfDaughters",
+    "numberOfMatchedStations", "numberOfMothers", "nTracks", "p", "partonFlavour",
+    "passConversionVeto", "pdgId", "phi", "phiWidth", "photonIso",
+    "puChargedHadronIso", "pt", "px", "py", "pz", "rapidity", "rawEnergy",
+    "sigmaIetaIeta", "sigmaZ", "significance", "status", "sumEt", "theta",
+    "trackIso", "vx", "vy", "vz", "x", "x0", "xError", "y", "y0", "yError", "z",
+    "z0", "zError",
+]
+
+arithmeticTypes = set([
+    "bool", "char", "double", "float", "int", "long", "short", "signed",
+    "unsigned", "size_t", "int8_t", "int16_t", "int32_t", "int64_t", "uint8_t",
+    "uint16_t", "uint32_t", "uint64_t",
+])
+
+returnTypePattern = r"(?:(?:const|static|inline|virtual)\s+)*((?:\w+\s+)*\w+)\s*&?\s*"
+memberFunction = re.compile(r"^\s*" + returnTypePattern + r"\b(\w+)\s*\(\s*(?:void)?\s*\)\s*const\b")
+dataMember = re.compile(r"^\s*" + returnTypePattern + r"\b(\w+)\s*(?:=[^;]*)?;")
+classDeclaration = re.compile(r"\b(?:class|struct)\s+(\w+)\s*(?::\s*([^{;]*))?(?:\{|$)")
+typedefDeclaration = re.compile(r"^\s*typedef\s+.*\b(\w+)\s*;")
+accessSpecifier = re.compile(r"^\s*(public|protected|private)\s*:")
+
+def isArithmetic(returnType):
+    words = [word for word in returnType.split() if word != "const"]
+    return len(words) > 0 and all(word in arithmeticTypes for word in words)
+
+def stripComments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags = re.DOTALL)
+    return re.sub(r"//.*", "", text)
+
+# Returns a dictionary mapping the name of each class in the osu namespace to a
+# pair of its osu:: base classes and its set of (member, kind) pairs. The
+# preprocessor conditionals are ignored, so the members of all branches are
+# collected.
+def parseHeader(fileName, classes):
+    text = stripComments(open(fileName).read())
+    depth = 0
+    namespaceDepth = None
+    pending = None          # class whose opening brace has not been seen yet
+    stack = []              # (name, depth of its body, access) of open classes
+    for line in text.splitlines():
+        if line.lstrip().startswith("#"):
+            continue
+        if namespaceDepth is None and re.match(r"^\s*namespace\s+osu\b", line):
+            pending = ("namespace", None)
+        elif namespaceDepth is not None and depth == namespaceDepth + 1 and not stack:
+            match = classDeclaration.search(line)
+            if match and not line.rstrip().endswith(";"):
+                bases = match.group(2) or ""
+                pending = (match.group(1), [b for b in classes if re.search(r"\b" + b + r"\b", bases)])
+                if "GenMatchable" in bases and "GenMatchable" not in pending[1]:
+                    pending[1].append("GenMatchable")
+            match = typedefDeclaration.match(line)
+            if match:
+                classes.setdefault(match.group(1), ([], set()))
+        elif stack and depth == stack[-1][1]:
+            match = accessSpecifier.match(line)
+            if match:
+                stack[-1] = (stack[-1][0], stack[-1][1], match.group(1))
+            elif stack[-1][2] == "public":
+                members = classes[stack[-1][0]][1]
+                match = memberFunction.match(line)
+                if match and isArithmetic(match.group(1)):
+                    members.add((match.group(2), "Function"))
+                match = dataMember.match(line)
+                if match and isArithmetic(match.group(1)):
+                    members.add((match.group(2), "Data"))
+
+        for character in line:
+            if character == "{":
+                depth += 1
+                if pending and pending[0] == "namespace":
+                    namespaceDepth = depth - 1
+                    pending = None
+                elif pending:
+                    name, bases = pending
+                    entry = classes.setdefault(name, ([], set()))
+                    entry[0].extend([b for b in bases if b not in entry[0]])
+                    stack.append((name, depth, "private"))
+                    pending = None
+            elif character == "}":
+                if stack and stack[-1][1] == depth:
+                    stack.pop()
+                depth -= 1
+                if namespaceDepth is not None and depth == namespaceDepth:
+                    namespaceDepth = None
+
+# Returns the patterns of the osu:: classes selected by the selection file, and
+# those excluded by it. The file is not well-formed XML, since the class names
+# contain angle brackets, so it is matched with regular expressions instead.
+def parseSelection(fileName):
+    text = re.sub(r"<!--.*?-->", "", open(fileName).read(), flags = re.DOTALL)
+    exclusions = "".join(re.findall(r"<exclusion>(.*?)</exclusion>", text, flags = re.DOTALL))
+    text = re.sub(r"<exclusion>.*?</exclusion>", "", text, flags = re.DOTALL)
+    classPattern = re.compile(r"<class\s+(?:name|pattern)\s*=\s*\"([^\"]*)\"")
+    selected = classPattern.findall(text)
+    excluded = classPattern.findall(exclusions)
+    return ([s for s in selected if s.startswith("osu::")], [e for e in excluded if e.startswith("osu::")])
+
+def collectMembers(name, classes, visited = None):
+    visited = visited or set()
+    if name in visited or name not in classes:
+        return set()
+    visited.add(name)
+    members = set(classes[name][1])
+    for base in classes[name][0]:
+        members |= collectMembers(base, classes, visited)
+    return members
+
+def main():
+    base = os.path.join(os.environ.get("CMSSW_BASE", ""), "src", "OSUT3Analysis")
+    parser = OptionParser()
+    parser.add_option("-b", "--base", dest="base", default=base,
+                      help="path to the OSUT3Analysis package [default: %default]")
+    parser.add_option("-o", "--output", dest="output", default=None,
+                      help="output file [default: AnaTools/src/AccessorTable.cc in the package]")
+    parser.add_option("-c", "--check", action="store_true", dest="check", default=False,
+                      help="only check that the output file is up to date")
+    (arguments, args) = parser.parse_args()
+
+    selectionFile = os.path.join(arguments.base, "Collections", "src", "classes_def.xml")
+    headerDirectory = os.path.join(arguments.base, "Collections", "interface")
+    output = arguments.output or os.path.join(arguments.base, "AnaTools", "src", "AccessorTable.cc")
+
+    if not os.path.isfile(selectionFile):
+        print "Could not find " + selectionFile + ". Please specify the package with '-b'."
+        sys.exit(1)
+
+    classes = {}
+    for header in sorted(os.listdir(headerDirectory)):
+        if header.endswith(".h"):
+            parseHeader(os.path.join(headerDirectory, header), classes)
+
+    selected, excluded = parseSelection(selectionFile)
+    def isSelected(name):
+        name = "osu::" + name
+        return any(fnmatch.fnmatchcase(name, s) for s in selected) and not any(fnmatch.fnmatchcase(name, e) for e in excluded)
+    # GenMatchable is a template and only ever used as a base class.
+    collections = sorted([c for c in classes if c != "GenMatchable" and isSelected(c)])
+
+    entries = {}
+    for name in collections:
+        members = collectMembers(name, classes)
+        members |= set([(m, "Function") for m in baseMembers])
+        entries[name] = sorted(members)
+    accessors = sorted(set([m for name in collections for m in entries[name]]))
+
+    fout = StringIO()
+    fout.write("// Generated by AnaTools/scripts/generateAccessorTable.py from\n")
+    fout.write("// Collections/src/classes_def.xml and the headers in Collections/interface.\n")
+    fout.write("// Do not edit by hand; rerun the script after changing either.\n\n")
+    fout.write("#include \"OSUT3Analysis/AnaTools/interface/AccessorTable.h\"\n")
+    fout.write("#include \"OSUT3Analysis/AnaTools/interface/AnalysisTypes.h\"\n\n")
+    fout.write("namespace\n{\n")
+    for member, kind in accessors:
+        macro = "MEMBER_FUNCTION_ACCESSOR" if kind == "Function" else "DATA_MEMBER_ACCESSOR"
+        fout.write("  " + macro + "(" + member + ")\n")
+    fout.write("}\n\n")
+    fout.write("void\nanatools::fillAccessorTable (AccessorTable &table)\n{\n")
+    for i, name in enumerate(collections):
+        if i:
+            fout.write("\n")
+        fout.write("  // osu::" + name + "\n")
+        for member, kind in entries[name]:
+            fout.write("  REGISTER_ACCESSOR(table, osu::" + name + ", " + member + ", " + kind + ")\n")
+    fout.write("}\n")
+
+    if arguments.check:
+        if not os.path.isfile(output) or open(output).read() != fout.getvalue():
+            print "ERROR:  " + output + " is out of date. Please rerun " + os.path.basename(sys.argv[0]) + " and commit the result."
+            sys.exit(1)
+        return
+
+    open(output, "w").write(fout.getvalue())
+
+    print "Wrote " + str(sum([len(entries[name]) for name in collections])) + " accessors for " + str(len(collections)) + " classes to " + output + "."
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,2903 @@
+// Generated by AnaTools/scripts/generateAccessorTable.py from
+// Collections/src/classes_def.xml and the headers in Collections/interface.
+// Do not edit by hand; rerun the script after changing either.
+
+#include "OSUT3Analysis/AnaTools/interface/AccessorTable.h"
+#include "OSUT3Analysis/AnaTools/interface/AnalysisTypes.h"
+
+namespace
+{
+  MEMBER_FUNCTION_ACCESSOR(AEff)
+  MEMBER_FUNCTION_ACCESSOR(Aeff_chargedHadron)
+  MEMBER_FUNCTION_ACCESSOR(Aeff_neutralHadron)
+  MEMBER_FUNCTION_ACCESSOR(Aeff_photon)
+  MEMBER_FUNCTION_ACCESSOR(BeamWidthX)
+  MEMBER_FUNCTION_ACCESSOR(BeamWidthY)
+  MEMBER_FUNCTION_ACCESSOR(alphamax)
+  MEMBER_FUNCTION_ACCESSOR(badChargedCandidateFilter)
+  MEMBER_FUNCTION_ACCESSOR(badPFMuonFilter)
+  MEMBER_FUNCTION_ACCESSOR(bestTrackMissingInnerHits)
+  MEMBER_FUNCTION_ACCESSOR(bestTrackMissingMiddleHits)
+  MEMBER_FUNCTION_ACCESSOR(bestTrackMissingOuterHits)
+  MEMBER_FUNCTION_ACCESSOR(bestTrackNumberOfValidHits)
+  MEMBER_FUNCTION_ACCESSOR(bestTrackNumberOfValidPixelBarrelHits)
+  MEMBER_FUNCTION_ACCESSOR(bestTrackNumberOfValidPixelEndcapHits)
+  MEMBER_FUNCTION_ACCESSOR(bestTrackNumberOfValidPixelHits)
+  MEMBER_FUNCTION_ACCESSOR(bremEnergy)
+  MEMBER_FUNCTION_ACCESSOR(caloIso)
+  MEMBER_FUNCTION_ACCESSOR(charge)
+  MEMBER_FUNCTION_ACCESSOR(chargedEmEnergyFraction)
+  MEMBER_FUNCTION_ACCESSOR(chargedHadronEnergyFraction)
+  MEMBER_FUNCTION_ACCESSOR(chargedHadronIso)
+  MEMBER_FUNCTION_ACCESSOR(chargedMultiplicity)
+  MEMBER_FUNCTION_ACCESSOR(chi2)
+  MEMBER_FUNCTION_ACCESSOR(d0)
+  MEMBER_FUNCTION_ACCESSOR(dB)
+  MEMBER_FUNCTION_ACCESSOR(dEtaInSeed)
+  MEMBER_FUNCTION_ACCESSOR(dRMinJet)
+  MEMBER_FUNCTION_ACCESSOR(dRToMatchedCandidateTrack)
+  MEMBER_FUNCTION_ACCESSOR(dRToMatchedGsfTrack)
+  MEMBER_FUNCTION_ACCESSOR(deltaEtaSuperClusterTrackAtVtx)
+  MEMBER_FUNCTION_ACCESSOR(deltaPhiSuperClusterTrackAtVtx)
+  MEMBER_FUNCTION_ACCESSOR(deltaRToClosestPFChHad)
+  MEMBER_FUNCTION_ACCESSOR(deltaRToClosestPFElectron)
+  MEMBER_FUNCTION_ACCESSOR(deltaRToClosestPFMuon)
+  MEMBER_FUNCTION_ACCESSOR(dxy)
+  MEMBER_FUNCTION_ACCESSOR(dz)
+  MEMBER_FUNCTION_ACCESSOR(eSuperClusterOverP)
+  MEMBER_FUNCTION_ACCESSOR(ecalEnergy)
+  MEMBER_FUNCTION_ACCESSOR(ecalIso)
+  MEMBER_FUNCTION_ACCESSOR(edB)
+  MEMBER_FUNCTION_ACCESSOR(electronPVIndex)
+  MEMBER_FUNCTION_ACCESSOR(energy)
+  MEMBER_FUNCTION_ACCESSOR(energyOfElectron)
+  MEMBER_FUNCTION_ACCESSOR(energyOfMuon)
+  MEMBER_FUNCTION_ACCESSOR(energyOfPion)
+  MEMBER_FUNCTION_ACCESSOR(energyOfProton)
+  MEMBER_FUNCTION_ACCESSOR(energyOfTau)
+  MEMBER_FUNCTION_ACCESSOR(et)
+  MEMBER_FUNCTION_ACCESSOR(eta)
+  MEMBER_FUNCTION_ACCESSOR(etaWidth)
+  MEMBER_FUNCTION_ACCESSOR(expectedPixelBarrelHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedPixelEndcapHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedPixelHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedStripHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedStripTECHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedStripTIBHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedStripTIDHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedStripTOBHits)
+  MEMBER_FUNCTION_ACCESSOR(expectedTrackerHits)
+  MEMBER_FUNCTION_ACCESSOR(fbrem)
+  MEMBER_FUNCTION_ACCESSOR(firstLayerWithValidHit)
+  MEMBER_FUNCTION_ACCESSOR(full5x5_sigmaIetaIeta)
+  MEMBER_FUNCTION_ACCESSOR(genD0)
+  MEMBER_FUNCTION_ACCESSOR(getBunchCrossing)
+  MEMBER_FUNCTION_ACCESSOR(getPU_NumInteractions)
+  MEMBER_FUNCTION_ACCESSOR(getTrueNumInteractions)
+  MEMBER_FUNCTION_ACCESSOR(gsfTrackMissingInnerHits)
+  MEMBER_FUNCTION_ACCESSOR(gsfTrackMissingMiddleHits)
+  MEMBER_FUNCTION_ACCESSOR(gsfTrackMissingOuterHits)
+  MEMBER_FUNCTION_ACCESSOR(gsfTrackNumberOfValidHits)
+  MEMBER_FUNCTION_ACCESSOR(gsfTrackNumberOfValidPixelBarrelHits)
+  MEMBER_FUNCTION_ACCESSOR(gsfTrackNumberOfValidPixelEndcapHits)
+  MEMBER_FUNCTION_ACCESSOR(gsfTrackNumberOfValidPixelHits)
+  MEMBER_FUNCTION_ACCESSOR(hadTowOverEm)
+  MEMBER_FUNCTION_ACCESSOR(hadronFlavour)
+  MEMBER_FUNCTION_ACCESSOR(hadronicOverEm)
+  MEMBER_FUNCTION_ACCESSOR(hasValidHitInPixelBarrelLayer1)
+  MEMBER_FUNCTION_ACCESSOR(hasValidHitInPixelBarrelLayer2)
+  MEMBER_FUNCTION_ACCESSOR(hasValidHitInPixelBarrelLayer3)
+  MEMBER_FUNCTION_ACCESSOR(hasValidHitInPixelEndcapLayer1)
+  MEMBER_FUNCTION_ACCESSOR(hasValidHitInPixelEndcapLayer2)
+  MEMBER_FUNCTION_ACCESSOR(hcalIso)
+  MEMBER_FUNCTION_ACCESSOR(hitAndTOBDrop_bestTrackMissingOuterHits)
+  MEMBER_FUNCTION_ACCESSOR(hitAndTOBDrop_gsfTrackMissingOuterHits)
+  MEMBER_FUNCTION_ACCESSOR(hitAndTOBDrop_missingOuterHits)
+  MEMBER_FUNCTION_ACCESSOR(hitDrop_bestTrackMissingMiddleHits)
+  MEMBER_FUNCTION_ACCESSOR(hitDrop_gsfTrackMissingMiddleHits)
+  MEMBER_FUNCTION_ACCESSOR(hitDrop_missingMiddleHits)
+  MEMBER_FUNCTION_ACCESSOR(inTOBCrack)
+  MEMBER_FUNCTION_ACCESSOR(innerP)
+  MEMBER_FUNCTION_ACCESSOR(ipsig)
+  MEMBER_FUNCTION_ACCESSOR(isEB)
+  MEMBER_FUNCTION_ACCESSOR(isEBEEGap)
+  MEMBER_FUNCTION_ACCESSOR(isEE)
+  MEMBER_FUNCTION_ACCESSOR(isElectron)
+  MEMBER_FUNCTION_ACCESSOR(isFake)
+  MEMBER_FUNCTION_ACCESSOR(isFiducialECALTrack)
+  MEMBER_FUNCTION_ACCESSOR(isFiducialElectronTrack)
+  MEMBER_FUNCTION_ACCESSOR(isFiducialMuonTrack)
+  MEMBER_FUNCTION_ACCESSOR(isGap)
+  MEMBER_FUNCTION_ACCESSOR(isGlobalMuon)
+  MEMBER_FUNCTION_ACCESSOR(isJet)
+  MEMBER_FUNCTION_ACCESSOR(isLooseMuon)
+  MEMBER_FUNCTION_ACCESSOR(isMuon)
+  MEMBER_FUNCTION_ACCESSOR(isPFMuon)
+  MEMBER_FUNCTION_ACCESSOR(isPhoton)
+  MEMBER_FUNCTION_ACCESSOR(isStandAloneMuon)
+  MEMBER_FUNCTION_ACCESSOR(isTightMuonWRTVtx)
+  MEMBER_FUNCTION_ACCESSOR(isTrackerMuon)
+  MEMBER_FUNCTION_ACCESSOR(isValid)
+  MEMBER_FUNCTION_ACCESSOR(jecUncertainty)
+  MEMBER_FUNCTION_ACCESSOR(jer)
+  MEMBER_FUNCTION_ACCESSOR(jerSF)
+  MEMBER_FUNCTION_ACCESSOR(jerSFDown)
+  MEMBER_FUNCTION_ACCESSOR(jerSFUp)
+  MEMBER_FUNCTION_ACCESSOR(jetArea)
+  MEMBER_FUNCTION_ACCESSOR(lastLayerWithValidHit)
+  MEMBER_FUNCTION_ACCESSOR(log10ipsig)
+  MEMBER_FUNCTION_ACCESSOR(mass)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_Ele22_eta2p1_WPLoose_Gsf_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_Ele25_eta2p1_WPTight_Gsf_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_Ele35_WPTight_Gsf_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_IsoMu20_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_IsoMu24_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_IsoMu27_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_IsoTkMu20_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_IsoTkMu24_v)
+  MEMBER_FUNCTION_ACCESSOR(match_HLT_LooseIsoPFTau50_Trk30_eta2p1_v)
+  MEMBER_FUNCTION_ACCESSOR(matchedToLepton)
+  MEMBER_FUNCTION_ACCESSOR(maxSigmaForFiducialElectronTrack)
+  MEMBER_FUNCTION_ACCESSOR(maxSigmaForFiducialMuonTrack)
+  MEMBER_FUNCTION_ACCESSOR(medianlog10ipsig)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOnePhi)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOnePt)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOnePx)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOnePy)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOneUpPhi)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOneUpPt)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOneUpPx)
+  MEMBER_FUNCTION_ACCESSOR(metMinusOneUpPy)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOnePhi)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOnePt)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOnePx)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOnePy)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOneUpPhi)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOneUpPt)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOneUpPx)
+  MEMBER_FUNCTION_ACCESSOR(metNoMuMinusOneUpPy)
+  MEMBER_FUNCTION_ACCESSOR(missingInnerHits)
+  MEMBER_FUNCTION_ACCESSOR(missingInnerHitsFromAllHits)
+  MEMBER_FUNCTION_ACCESSOR(missingInnerHitsFromLostHits)
+  MEMBER_FUNCTION_ACCESSOR(missingInnerHitsFromTrackerLayersWithoutMeasurements)
+  MEMBER_FUNCTION_ACCESSOR(missingMiddleHits)
+  MEMBER_FUNCTION_ACCESSOR(missingMiddleHitsFromTrackerLayersWithoutMeasurements)
+  MEMBER_FUNCTION_ACCESSOR(missingOuterHits)
+  MEMBER_FUNCTION_ACCESSOR(missingOuterHitsFromTrackerLayersWithoutMeasurements)
+  MEMBER_FUNCTION_ACCESSOR(missingPixelBarrelHits)
+  MEMBER_FUNCTION_ACCESSOR(missingPixelEndcapHits)
+  MEMBER_FUNCTION_ACCESSOR(missingPixelHits)
+  MEMBER_FUNCTION_ACCESSOR(missingStripHits)
+  MEMBER_FUNCTION_ACCESSOR(missingStripTECHits)
+  MEMBER_FUNCTION_ACCESSOR(missingStripTIBHits)
+  MEMBER_FUNCTION_ACCESSOR(missingStripTIDHits)
+  MEMBER_FUNCTION_ACCESSOR(missingStripTOBHits)
+  MEMBER_FUNCTION_ACCESSOR(missingTrackerHits)
+  MEMBER_FUNCTION_ACCESSOR(mt)
+  MEMBER_FUNCTION_ACCESSOR(muonEnergyFraction)
+  MEMBER_FUNCTION_ACCESSOR(muonPVIndex)
+  MEMBER_FUNCTION_ACCESSOR(nTracks)
+  MEMBER_FUNCTION_ACCESSOR(ndof)
+  MEMBER_FUNCTION_ACCESSOR(neutralEmEnergyFraction)
+  MEMBER_FUNCTION_ACCESSOR(neutralHadronEnergyFraction)
+  MEMBER_FUNCTION_ACCESSOR(neutralHadronIso)
+  MEMBER_FUNCTION_ACCESSOR(neutralMultiplicity)
+  MEMBER_FUNCTION_ACCESSOR(noMuPhi)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_ElectronEnDown)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_ElectronEnUp)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_JetEnDown)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_JetEnUp)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_JetResDown)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_JetResUp)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_PhotonEnDown)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_PhotonEnUp)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_TauEnDown)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_TauEnUp)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_UnclusteredEnDown)
+  MEMBER_FUNCTION_ACCESSOR(noMuPt_UnclusteredEnUp)
+  MEMBER_FUNCTION_ACCESSOR(noMuPx)
+  MEMBER_FUNCTION_ACCESSOR(noMuPy)
+  MEMBER_FUNCTION_ACCESSOR(normalizedChi2)
+  MEMBER_FUNCTION_ACCESSOR(numberOfChambers)
+  MEMBER_FUNCTION_ACCESSOR(numberOfDaughters)
+  MEMBER_FUNCTION_ACCESSOR(numberOfMatchedStations)
+  MEMBER_FUNCTION_ACCESSOR(numberOfMothers)
+  MEMBER_FUNCTION_ACCESSOR(numberOfPixelBarrelHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfPixelEndcapHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfPixelHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfStripHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfStripTECHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfStripTIBHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfStripTIDHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfStripTOBHits)
+  MEMBER_FUNCTION_ACCESSOR(numberOfTrackerHits)
+  MEMBER_FUNCTION_ACCESSOR(outerP)
+  MEMBER_FUNCTION_ACCESSOR(p)
+  MEMBER_FUNCTION_ACCESSOR(packedPixelBarrelHitPattern)
+  MEMBER_FUNCTION_ACCESSOR(packedPixelEndcapHitPattern)
+  MEMBER_FUNCTION_ACCESSOR(partonFlavour)
+  MEMBER_FUNCTION_ACCESSOR(passConversionVeto)
+  MEMBER_FUNCTION_ACCESSOR(passesDecayModeReconstruction)
+  MEMBER_FUNCTION_ACCESSOR(passesLightFlavorRejection)
+  MEMBER_FUNCTION_ACCESSOR(passesLooseCombinedIsolation)
+  MEMBER_FUNCTION_ACCESSOR(passesMediumCombinedIsolation)
+  MEMBER_FUNCTION_ACCESSOR(passesTightCombinedIsolation)
+  MEMBER_FUNCTION_ACCESSOR(passesTightID_noIsolation)
+  MEMBER_FUNCTION_ACCESSOR(passesVID_looseID)
+  MEMBER_FUNCTION_ACCESSOR(passesVID_mediumID)
+  MEMBER_FUNCTION_ACCESSOR(passesVID_tightID)
+  MEMBER_FUNCTION_ACCESSOR(passesVID_vetoID)
+  MEMBER_FUNCTION_ACCESSOR(pdgId)
+  MEMBER_FUNCTION_ACCESSOR(pfCombinedInclusiveSecondaryVertexV2BJetTags)
+  MEMBER_FUNCTION_ACCESSOR(pfCombinedSecondaryVertexV2BJetTags)
+  MEMBER_FUNCTION_ACCESSOR(pfdBetaIsoCorr)
+  MEMBER_FUNCTION_ACCESSOR(pfdRhoIsoCorr)
+  MEMBER_FUNCTION_ACCESSOR(phi)
+  MEMBER_FUNCTION_ACCESSOR(phiWidth)
+  MEMBER_FUNCTION_ACCESSOR(photonIso)
+  MEMBER_FUNCTION_ACCESSOR(pileupJetId)
+  MEMBER_FUNCTION_ACCESSOR(pt)
+  MEMBER_FUNCTION_ACCESSOR(pt_ElectronEnDown)
+  MEMBER_FUNCTION_ACCESSOR(pt_ElectronEnUp)
+  MEMBER_FUNCTION_ACCESSOR(pt_JetEnDown)
+  MEMBER_FUNCTION_ACCESSOR(pt_JetEnUp)
+  MEMBER_FUNCTION_ACCESSOR(pt_JetResDown)
+  MEMBER_FUNCTION_ACCESSOR(pt_JetResUp)
+  MEMBER_FUNCTION_ACCESSOR(pt_MuonEnDown)
+  MEMBER_FUNCTION_ACCESSOR(pt_MuonEnUp)
+  MEMBER_FUNCTION_ACCESSOR(pt_PhotonEnDown)
+  MEMBER_FUNCTION_ACCESSOR(pt_PhotonEnUp)
+  MEMBER_FUNCTION_ACCESSOR(pt_TauEnDown)
+  MEMBER_FUNCTION_ACCESSOR(pt_TauEnUp)
+  MEMBER_FUNCTION_ACCESSOR(pt_UnclusteredEnDown)
+  MEMBER_FUNCTION_ACCESSOR(pt_UnclusteredEnUp)
+  MEMBER_FUNCTION_ACCESSOR(puChargedHadronIso)
+  MEMBER_FUNCTION_ACCESSOR(px)
+  MEMBER_FUNCTION_ACCESSOR(py)
+  MEMBER_FUNCTION_ACCESSOR(pz)
+  MEMBER_FUNCTION_ACCESSOR(rapidity)
+  MEMBER_FUNCTION_ACCESSOR(rawEnergy)
+  MEMBER_FUNCTION_ACCESSOR(rho)
+  MEMBER_FUNCTION_ACCESSOR(sigmaIetaIeta)
+  MEMBER_FUNCTION_ACCESSOR(sigmaZ)
+  MEMBER_FUNCTION_ACCESSOR(significance)
+  MEMBER_FUNCTION_ACCESSOR(smearedPt)
+  MEMBER_FUNCTION_ACCESSOR(smearedPtDown)
+  MEMBER_FUNCTION_ACCESSOR(smearedPtUp)
+  MEMBER_FUNCTION_ACCESSOR(status)
+  MEMBER_FUNCTION_ACCESSOR(sumChargedHadronPtCorr)
+  MEMBER_FUNCTION_ACCESSOR(sumEt)
+  MEMBER_FUNCTION_ACCESSOR(sumPUPtCorr)
+  MEMBER_FUNCTION_ACCESSOR(theta)
+  MEMBER_FUNCTION_ACCESSOR(trackIso)
+  MEMBER_FUNCTION_ACCESSOR(vx)
+  MEMBER_FUNCTION_ACCESSOR(vy)
+  MEMBER_FUNCTION_ACCESSOR(vz)
+  MEMBER_FUNCTION_ACCESSOR(x)
+  MEMBER_FUNCTION_ACCESSOR(x0)
+  MEMBER_FUNCTION_ACCESSOR(xError)
+  MEMBER_FUNCTION_ACCESSOR(y)
+  MEMBER_FUNCTION_ACCESSOR(y0)
+  MEMBER_FUNCTION_ACCESSOR(yError)
+  MEMBER_FUNCTION_ACCESSOR(z)
+  MEMBER_FUNCTION_ACCESSOR(z0)
+  MEMBER_FUNCTION_ACCESSOR(zError)
+}
+
+void
+anatools::fillAccessorTable (AccessorTable &table)
+{
+  // osu::Beamspot
+  REGISTER_ACCESSOR(table, osu::Beamspot, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, et, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, p, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, px, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, py, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, status, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, x, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, y, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, z, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Beamspot, zError, Function)
+
+  // osu::Bjet
+  REGISTER_ACCESSOR(table, osu::Bjet, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, alphamax, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, et, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, ipsig, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, jecUncertainty, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, jer, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, jerSF, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, jerSFDown, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, jerSFUp, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, log10ipsig, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, matchedToLepton, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, medianlog10ipsig, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, p, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, pfCombinedInclusiveSecondaryVertexV2BJetTags, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, pfCombinedSecondaryVertexV2BJetTags, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, pileupJetId, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, px, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, py, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, smearedPt, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, smearedPtDown, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, smearedPtUp, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, status, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, x, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, y, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, z, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Bjet, zError, Function)
+
+  // osu::Bxlumi
+  REGISTER_ACCESSOR(table, osu::Bxlumi, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, et, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, p, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, px, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, py, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, status, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, x, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, y, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, z, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Bxlumi, zError, Function)
+
+  // osu::Cschit
+  REGISTER_ACCESSOR(table, osu::Cschit, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, et, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, p, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, px, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, py, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, status, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, x, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, y, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, z, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Cschit, zError, Function)
+
+  // osu::Cscseg
+  REGISTER_ACCESSOR(table, osu::Cscseg, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, et, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, p, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, px, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, py, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, status, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, x, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, y, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, z, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Cscseg, zError, Function)
+
+  // osu::Dtseg
+  REGISTER_ACCESSOR(table, osu::Dtseg, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, et, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, p, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, px, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, py, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, status, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, x, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, y, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, z, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Dtseg, zError, Function)
+
+  // osu::Electron
+  REGISTER_ACCESSOR(table, osu::Electron, AEff, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, dEtaInSeed, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, electronPVIndex, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, et, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, genD0, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, match_HLT_Ele22_eta2p1_WPLoose_Gsf_v, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, match_HLT_Ele25_eta2p1_WPTight_Gsf_v, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, match_HLT_Ele35_WPTight_Gsf_v, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOnePhi, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOnePt, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOnePx, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOnePy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOneUpPhi, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOneUpPt, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOneUpPx, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metMinusOneUpPy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOnePhi, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOnePt, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOnePx, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOnePy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOneUpPhi, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOneUpPt, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOneUpPx, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, metNoMuMinusOneUpPy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, missingInnerHitsFromAllHits, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, missingInnerHitsFromLostHits, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, missingInnerHitsFromTrackerLayersWithoutMeasurements, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, missingMiddleHitsFromTrackerLayersWithoutMeasurements, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, missingOuterHitsFromTrackerLayersWithoutMeasurements, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, p, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, passesTightID_noIsolation, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, passesVID_looseID, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, passesVID_mediumID, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, passesVID_tightID, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, passesVID_vetoID, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, pfdRhoIsoCorr, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, px, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, py, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, rho, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, status, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, sumChargedHadronPtCorr, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, sumPUPtCorr, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, x, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, y, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, z, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Electron, zError, Function)
+
+  // osu::Event
+  REGISTER_ACCESSOR(table, osu::Event, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Event, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Event, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Event, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Event, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Event, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Event, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Event, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Event, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Event, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Event, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Event, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Event, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Event, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Event, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Event, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Event, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Event, et, Function)
+  REGISTER_ACCESSOR(table, osu::Event, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Event, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Event, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Event, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Event, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Event, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Event, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Event, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Event, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Event, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Event, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Event, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Event, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Event, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Event, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Event, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Event, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Event, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Event, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Event, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Event, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Event, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Event, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Event, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Event, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Event, p, Function)
+  REGISTER_ACCESSOR(table, osu::Event, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Event, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Event, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Event, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Event, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Event, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Event, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, px, Function)
+  REGISTER_ACCESSOR(table, osu::Event, py, Function)
+  REGISTER_ACCESSOR(table, osu::Event, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Event, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Event, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Event, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Event, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Event, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Event, status, Function)
+  REGISTER_ACCESSOR(table, osu::Event, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Event, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Event, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Event, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Event, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Event, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Event, x, Function)
+  REGISTER_ACCESSOR(table, osu::Event, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Event, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Event, y, Function)
+  REGISTER_ACCESSOR(table, osu::Event, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Event, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Event, z, Function)
+  REGISTER_ACCESSOR(table, osu::Event, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Event, zError, Function)
+
+  // osu::Eventvariable
+  REGISTER_ACCESSOR(table, osu::Eventvariable, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, et, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, p, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, px, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, py, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, status, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, x, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, y, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, z, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Eventvariable, zError, Function)
+
+  // osu::Genjet
+  REGISTER_ACCESSOR(table, osu::Genjet, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, et, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, p, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, px, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, py, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, status, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, x, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, y, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, z, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Genjet, zError, Function)
+
+  // osu::Jet
+  REGISTER_ACCESSOR(table, osu::Jet, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, alphamax, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, et, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, ipsig, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, jecUncertainty, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, jer, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, jerSF, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, jerSFDown, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, jerSFUp, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, log10ipsig, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, matchedToLepton, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, medianlog10ipsig, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, p, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, pfCombinedInclusiveSecondaryVertexV2BJetTags, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, pfCombinedSecondaryVertexV2BJetTags, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, pileupJetId, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, px, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, py, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, smearedPt, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, smearedPtDown, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, smearedPtUp, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, status, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, x, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, y, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, z, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Jet, zError, Function)
+
+  // osu::Mcparticle
+  REGISTER_ACCESSOR(table, osu::Mcparticle, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, et, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, p, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, px, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, py, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, status, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, x, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, y, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, z, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Mcparticle, zError, Function)
+
+  // osu::Met
+  REGISTER_ACCESSOR(table, osu::Met, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Met, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Met, badChargedCandidateFilter, Function)
+  REGISTER_ACCESSOR(table, osu::Met, badPFMuonFilter, Function)
+  REGISTER_ACCESSOR(table, osu::Met, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Met, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Met, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Met, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Met, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Met, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Met, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Met, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Met, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Met, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Met, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Met, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Met, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Met, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Met, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Met, et, Function)
+  REGISTER_ACCESSOR(table, osu::Met, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Met, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Met, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Met, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Met, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Met, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Met, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Met, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Met, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Met, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Met, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Met, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Met, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Met, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Met, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Met, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Met, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Met, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Met, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Met, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPhi, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_ElectronEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_ElectronEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_JetEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_JetEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_JetResDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_JetResUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_PhotonEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_PhotonEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_TauEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_TauEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_UnclusteredEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPt_UnclusteredEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPx, Function)
+  REGISTER_ACCESSOR(table, osu::Met, noMuPy, Function)
+  REGISTER_ACCESSOR(table, osu::Met, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Met, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Met, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Met, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Met, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Met, p, Function)
+  REGISTER_ACCESSOR(table, osu::Met, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Met, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Met, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Met, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Met, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_ElectronEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_ElectronEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_JetEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_JetEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_JetResDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_JetResUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_MuonEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_MuonEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_PhotonEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_PhotonEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_TauEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_TauEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_UnclusteredEnDown, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pt_UnclusteredEnUp, Function)
+  REGISTER_ACCESSOR(table, osu::Met, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, px, Function)
+  REGISTER_ACCESSOR(table, osu::Met, py, Function)
+  REGISTER_ACCESSOR(table, osu::Met, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Met, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Met, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Met, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Met, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Met, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Met, status, Function)
+  REGISTER_ACCESSOR(table, osu::Met, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Met, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Met, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Met, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Met, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Met, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Met, x, Function)
+  REGISTER_ACCESSOR(table, osu::Met, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Met, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Met, y, Function)
+  REGISTER_ACCESSOR(table, osu::Met, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Met, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Met, z, Function)
+  REGISTER_ACCESSOR(table, osu::Met, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Met, zError, Function)
+
+  // osu::Muon
+  REGISTER_ACCESSOR(table, osu::Muon, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, et, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, genD0, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isTightMuonWRTVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, match_HLT_IsoMu20_v, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, match_HLT_IsoMu24_v, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, match_HLT_IsoMu27_v, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, match_HLT_IsoTkMu20_v, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, match_HLT_IsoTkMu24_v, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metMinusOnePhi, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metMinusOnePt, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metMinusOnePx, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metMinusOnePy, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metNoMuMinusOnePhi, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metNoMuMinusOnePt, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metNoMuMinusOnePx, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, metNoMuMinusOnePy, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, missingInnerHitsFromTrackerLayersWithoutMeasurements, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, missingMiddleHitsFromTrackerLayersWithoutMeasurements, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, missingOuterHitsFromTrackerLayersWithoutMeasurements, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, muonPVIndex, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, p, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, pfdBetaIsoCorr, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, px, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, py, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, status, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, sumChargedHadronPtCorr, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, sumPUPtCorr, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, x, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, y, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, z, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Muon, zError, Function)
+
+  // osu::Photon
+  REGISTER_ACCESSOR(table, osu::Photon, Aeff_chargedHadron, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, Aeff_neutralHadron, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, Aeff_photon, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, et, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, p, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, px, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, py, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, rho, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, status, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, x, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, y, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, z, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Photon, zError, Function)
+
+  // osu::PileUpInfo
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, charge, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, d0, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, dB, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, dz, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, edB, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, energy, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, et, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, eta, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, mass, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, mt, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, p, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, phi, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, pt, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, px, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, py, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, pz, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, significance, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, status, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, theta, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, vx, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, vy, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, vz, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, x, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, x0, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, xError, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, y, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, y0, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, yError, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, z, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, z0, Function)
+  REGISTER_ACCESSOR(table, osu::PileUpInfo, zError, Function)
+
+  // osu::Primaryvertex
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, et, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, p, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, px, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, py, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, status, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, x, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, y, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, z, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Primaryvertex, zError, Function)
+
+  // osu::Rpchit
+  REGISTER_ACCESSOR(table, osu::Rpchit, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, et, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, p, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, px, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, py, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, status, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, x, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, y, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, z, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Rpchit, zError, Function)
+
+  // osu::SecondaryTrack
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bestTrackMissingInnerHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bestTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bestTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bestTrackNumberOfValidHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bestTrackNumberOfValidPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bestTrackNumberOfValidPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bestTrackNumberOfValidPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, bremEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, charge, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, d0, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, dB, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, dRMinJet, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, dRToMatchedCandidateTrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, dRToMatchedGsfTrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, deltaRToClosestPFChHad, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, deltaRToClosestPFElectron, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, deltaRToClosestPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, dz, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, edB, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, energy, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, energyOfElectron, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, energyOfMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, energyOfPion, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, energyOfProton, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, energyOfTau, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, et, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, eta, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedStripHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedStripTECHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedStripTIBHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedStripTIDHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedStripTOBHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, expectedTrackerHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, fbrem, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, firstLayerWithValidHit, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, gsfTrackMissingInnerHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, gsfTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, gsfTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, gsfTrackNumberOfValidHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, gsfTrackNumberOfValidPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, gsfTrackNumberOfValidPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, gsfTrackNumberOfValidPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hasValidHitInPixelBarrelLayer1, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hasValidHitInPixelBarrelLayer2, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hasValidHitInPixelBarrelLayer3, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hasValidHitInPixelEndcapLayer1, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hasValidHitInPixelEndcapLayer2, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hitAndTOBDrop_bestTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hitAndTOBDrop_gsfTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hitAndTOBDrop_missingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hitDrop_bestTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hitDrop_gsfTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, hitDrop_missingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, inTOBCrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, innerP, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isFiducialECALTrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isFiducialElectronTrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isFiducialMuonTrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, lastLayerWithValidHit, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, mass, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, maxSigmaForFiducialElectronTrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, maxSigmaForFiducialMuonTrack, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingInnerHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingStripHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingStripTECHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingStripTIBHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingStripTIDHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingStripTOBHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, missingTrackerHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, mt, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfStripHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfStripTECHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfStripTIBHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfStripTIDHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfStripTOBHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, numberOfTrackerHits, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, outerP, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, p, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, packedPixelBarrelHitPattern, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, packedPixelEndcapHitPattern, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, phi, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, pt, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, px, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, py, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, pz, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, significance, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, status, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, theta, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, vx, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, vy, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, vz, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, x, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, x0, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, xError, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, y, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, y0, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, yError, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, z, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, z0, Function)
+  REGISTER_ACCESSOR(table, osu::SecondaryTrack, zError, Function)
+
+  // osu::Supercluster
+  REGISTER_ACCESSOR(table, osu::Supercluster, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, et, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, p, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, px, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, py, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, status, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, x, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, y, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, z, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Supercluster, zError, Function)
+
+  // osu::Tau
+  REGISTER_ACCESSOR(table, osu::Tau, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, et, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, match_HLT_LooseIsoPFTau50_Trk30_eta2p1_v, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOnePhi, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOnePt, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOnePx, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOnePy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOneUpPhi, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOneUpPt, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOneUpPx, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metMinusOneUpPy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOnePhi, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOnePt, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOnePx, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOnePy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOneUpPhi, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOneUpPt, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOneUpPx, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, metNoMuMinusOneUpPy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, p, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, passesDecayModeReconstruction, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, passesLightFlavorRejection, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, passesLooseCombinedIsolation, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, passesMediumCombinedIsolation, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, passesTightCombinedIsolation, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, px, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, py, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, status, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, x, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, y, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, z, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Tau, zError, Function)
+
+  // osu::Track
+  REGISTER_ACCESSOR(table, osu::Track, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Track, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bestTrackMissingInnerHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bestTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bestTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bestTrackNumberOfValidHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bestTrackNumberOfValidPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bestTrackNumberOfValidPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bestTrackNumberOfValidPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, bremEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Track, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Track, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Track, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Track, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Track, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Track, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Track, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Track, dRMinJet, Function)
+  REGISTER_ACCESSOR(table, osu::Track, dRToMatchedCandidateTrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, dRToMatchedGsfTrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Track, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Track, deltaRToClosestPFChHad, Function)
+  REGISTER_ACCESSOR(table, osu::Track, deltaRToClosestPFElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Track, deltaRToClosestPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Track, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Track, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Track, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Track, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Track, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Track, energyOfElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Track, energyOfMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, energyOfPion, Function)
+  REGISTER_ACCESSOR(table, osu::Track, energyOfProton, Function)
+  REGISTER_ACCESSOR(table, osu::Track, energyOfTau, Function)
+  REGISTER_ACCESSOR(table, osu::Track, et, Function)
+  REGISTER_ACCESSOR(table, osu::Track, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Track, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedStripHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedStripTECHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedStripTIBHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedStripTIDHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedStripTOBHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, expectedTrackerHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, fbrem, Function)
+  REGISTER_ACCESSOR(table, osu::Track, firstLayerWithValidHit, Function)
+  REGISTER_ACCESSOR(table, osu::Track, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Track, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Track, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Track, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Track, gsfTrackMissingInnerHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, gsfTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, gsfTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, gsfTrackNumberOfValidHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, gsfTrackNumberOfValidPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, gsfTrackNumberOfValidPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, gsfTrackNumberOfValidPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hasValidHitInPixelBarrelLayer1, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hasValidHitInPixelBarrelLayer2, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hasValidHitInPixelBarrelLayer3, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hasValidHitInPixelEndcapLayer1, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hasValidHitInPixelEndcapLayer2, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hitAndTOBDrop_bestTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hitAndTOBDrop_gsfTrackMissingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hitAndTOBDrop_missingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hitDrop_bestTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hitDrop_gsfTrackMissingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, hitDrop_missingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, inTOBCrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, innerP, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isFiducialECALTrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isFiducialElectronTrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isFiducialMuonTrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Track, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Track, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Track, lastLayerWithValidHit, Function)
+  REGISTER_ACCESSOR(table, osu::Track, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Track, maxSigmaForFiducialElectronTrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, maxSigmaForFiducialMuonTrack, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingInnerHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingMiddleHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingOuterHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingStripHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingStripTECHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingStripTIBHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingStripTIDHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingStripTOBHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, missingTrackerHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Track, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Track, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Track, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Track, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Track, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Track, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Track, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfPixelBarrelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfPixelEndcapHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfPixelHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfStripHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfStripTECHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfStripTIBHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfStripTIDHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfStripTOBHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, numberOfTrackerHits, Function)
+  REGISTER_ACCESSOR(table, osu::Track, outerP, Function)
+  REGISTER_ACCESSOR(table, osu::Track, p, Function)
+  REGISTER_ACCESSOR(table, osu::Track, packedPixelBarrelHitPattern, Function)
+  REGISTER_ACCESSOR(table, osu::Track, packedPixelEndcapHitPattern, Function)
+  REGISTER_ACCESSOR(table, osu::Track, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Track, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Track, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Track, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Track, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Track, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Track, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, px, Function)
+  REGISTER_ACCESSOR(table, osu::Track, py, Function)
+  REGISTER_ACCESSOR(table, osu::Track, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Track, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Track, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Track, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Track, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Track, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Track, status, Function)
+  REGISTER_ACCESSOR(table, osu::Track, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Track, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Track, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Track, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Track, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Track, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Track, x, Function)
+  REGISTER_ACCESSOR(table, osu::Track, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Track, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Track, y, Function)
+  REGISTER_ACCESSOR(table, osu::Track, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Track, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Track, z, Function)
+  REGISTER_ACCESSOR(table, osu::Track, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Track, zError, Function)
+
+  // osu::Trigobj
+  REGISTER_ACCESSOR(table, osu::Trigobj, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, et, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, p, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, px, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, py, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, status, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, x, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, y, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, z, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Trigobj, zError, Function)
+
+  // osu::Uservariable
+  REGISTER_ACCESSOR(table, osu::Uservariable, BeamWidthX, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, BeamWidthY, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, caloIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, charge, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, chargedEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, chargedHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, chargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, chargedMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, chi2, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, d0, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, dB, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, deltaEtaSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, deltaPhiSuperClusterTrackAtVtx, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, dxy, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, dz, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, eSuperClusterOverP, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, ecalEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, ecalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, edB, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, energy, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, et, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, eta, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, etaWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, full5x5_sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, getBunchCrossing, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, getPU_NumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, getTrueNumInteractions, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, hadTowOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, hadronFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, hadronicOverEm, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, hcalIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isEB, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isEBEEGap, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isEE, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isElectron, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isFake, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isGap, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isGlobalMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isJet, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isLooseMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isPFMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isPhoton, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isStandAloneMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isTrackerMuon, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, isValid, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, jetArea, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, mass, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, mt, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, muonEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, nTracks, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, ndof, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, neutralEmEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, neutralHadronEnergyFraction, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, neutralHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, neutralMultiplicity, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, normalizedChi2, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, numberOfChambers, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, numberOfDaughters, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, numberOfMatchedStations, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, numberOfMothers, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, p, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, partonFlavour, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, passConversionVeto, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, pdgId, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, phi, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, phiWidth, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, photonIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, pt, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, puChargedHadronIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, px, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, py, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, pz, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, rapidity, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, rawEnergy, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, sigmaIetaIeta, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, sigmaZ, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, significance, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, status, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, sumEt, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, theta, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, trackIso, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, vx, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, vy, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, vz, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, x, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, x0, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, xError, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, y, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, y0, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, yError, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, z, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, z0, Function)
+  REGISTER_ACCESSOR(table, osu::Uservariable, zError, Function)
+}
@@ -1,3 +1,5 @@
+#include <mutex>
+
 #include "OSUT3Analysis/AnaTools/interface/CommonUtils.h"
 
 /**
@@ -155,26 +157,6 @@ anatools::firstOfTupleDescending (tuple<size_t, size_t, string> a, tuple<size_t,
   return (get<0> (a) > get<0> (b));
 }
 
-/**
- * Returns whether the collection indices are in ascending order.
- *
- * This function is meant to be used with std::sort to sort a vector so that
- * the collection indices are in ascending order. The collection index is the
- * first member of the tuple in the input pairs. This sorting is used in
- * determining which combinations of objects should be ignored to avoid double
- * counting in ValueLookupTree.
- *
- * @param  a first of two objects to compare
- * @param  b second of two objects to compare
- * @return boolean representing whether the collection indices of the two
- *         objects are in ascending order
- */
-bool
-anatools::collectionIndexAscending (pair<string, DressedObject> a, pair<string, DressedObject> b)
-{
-  return (a.second.collectionIndex < b.second.collectionIndex);
-}
-
 /**
  * Retrieves all required collections from the event.
  *
@@ -191,6 +173,11 @@ anatools::getRequiredCollections (const unordered_set<string> &objectsToGet, Col
 {
   static bool firstEvent = true;
 
+  // The collection sizes may have changed, so mark the index tables from the
+  // previous event as stale. They are refilled in place, rather than rebuilt.
+  for (auto &table : handles.combinationTables)
+    table.second.isFilled = false;
+
   //////////////////////////////////////////////////////////////////////////////
   // Retrieve each object collection which we need and print a warning if it is
   // missing.
@@ -232,6 +219,7 @@ anatools::getRequiredCollections (const unordered_set<string> &objectsToGet, Col
     }
   if  (VEC_CONTAINS  (objectsToGet,  "eventvariables"))
     {
+      handles.mergedEventvariablesAreFilled = false;
       handles.eventvariables.clear ();
       for (const auto &token : tokens.eventvariables)
         {
@@ -239,6 +227,12 @@ anatools::getRequiredCollections (const unordered_set<string> &objectsToGet, Col
           event.getByToken (token, handles.eventvariables.back ());
         }
     }
+  handles.selectedIndices.clear ();
+  for (const auto &token : tokens.selectedIndices)
+    {
+      if (VEC_CONTAINS (objectsToGet, token.first))
+        event.getByToken (token.second, handles.selectedIndices[token.first]);
+    }
 
   if (firstEvent)
     {
@@ -303,170 +297,361 @@ anatools::getRequiredCollections (const unordered_set<string> &objectsToGet, Col
   firstEvent = false;
 }
 
+// Names of the event variables used in any expression, indexed by the values
+// returned by anatools::getEventVariableIndex. They are only added to while
+// the modules are constructed, which may happen concurrently, so the mutex
+// guards the additions; during the event loop they are only read.
+static vector<string> eventVariableNames;
+static unordered_map<string, unsigned> eventVariableIndices;
+static mutex eventVariableMutex;
+
+/**
+ * Returns the index of an event variable in the merged event variables.
+ *
+ * The first time a name is seen, it is assigned the next free index. This must
+ * only be called when expressions are parsed, i.e., when the modules are
+ * constructed, so that the list of event variables is fixed during the event
+ * loop and looking up an event variable is only an array access.
+ *
+ * @param  name name of the event variable
+ * @return index of the event variable in Collections::mergedEventvariables
+ */
+unsigned
+anatools::getEventVariableIndex (const string &name)
+{
+  lock_guard<mutex> lock (eventVariableMutex);
+  auto index = eventVariableIndices.find (name);
+  if (index != eventVariableIndices.end ())
+    return index->second;
+
+  eventVariableNames.push_back (name);
+  return (eventVariableIndices[name] = eventVariableNames.size () - 1);
+}
+
+/**
+ * Returns the merged event variables for the current event.
+ *
+ * The values from all of the eventvariables handles are copied into a flat
+ * vector the first time this is called in an event; later calls in the same
+ * event return the same vector. As when the handles were merged into a single
+ * map, the first handle containing a variable takes precedence. Variables
+ * which are not found in any handle are set to INVALID_VALUE.
+ *
+ * @param  handles structure containing the eventvariables handles
+ * @return vector of event variable values, indexed by getEventVariableIndex
+ */
+const vector<double> &
+anatools::getMergedEventVariables (Collections &handles)
+{
+  if (handles.mergedEventvariablesAreFilled && handles.mergedEventvariables.size () == eventVariableNames.size ())
+    return handles.mergedEventvariables;
+
+  handles.mergedEventvariables.assign (eventVariableNames.size (), INVALID_VALUE);
+#if IS_VALID(eventvariables)
+  for (unsigned i = 0; i < eventVariableNames.size (); i++)
+    {
+      for (const auto &handle : handles.eventvariables)
+        {
+          if (!handle.isValid ())
+            continue;
+          auto variable = handle->find (eventVariableNames.at (i));
+          if (variable != handle->end ())
+            {
+              handles.mergedEventvariables.at (i) = variable->second;
+              break;
+            }
+        }
+    }
+#endif
+  handles.mergedEventvariablesAreFilled = true;
+
+  return handles.mergedEventvariables;
+}
+
+/**
+ * Packs a vector of flags into the bits of a FlagBits object.
+ *
+ * @param  flags vector of flags to pack
+ * @param  bits  FlagBits object which is filled
+ */
+void
+anatools::packFlags (const vector<bool> &flags, FlagBits &bits)
+{
+  bits.clear ();
+  for (const auto &flag : flags)
+    bits.push_back (flag);
+}
+
+/**
+ * Packs the object flags for the given collections.
+ *
+ * A block of flags is added for each cut and collection. If a collection has
+ * no flags for a cut, its block is marked as absent. If its flags are the same
+ * as for the previous cut, its block is marked as such and the flags are not
+ * stored again. Otherwise, the flag and validity of each object are stored as
+ * two bits.
+ *
+ * @param  flagMap     object flags for each cut
+ * @param  collections collections whose flags are packed, in order
+ * @param  packed      PackedFlagMap which is filled
+ */
+void
+anatools::packObjectFlags (const FlagMap &flagMap, const vector<string> &collections, PackedFlagMap &packed)
+{
+  packed.blockCodes.clear ();
+  packed.blockSizes.clear ();
+  packed.flags.clear ();
+  for (unsigned cutIndex = 0; cutIndex != flagMap.size (); cutIndex++)
+    {
+      for (const auto &collection : collections)
+        {
+          auto flags = flagMap.at (cutIndex).find (collection);
+          if (flags == flagMap.at (cutIndex).end ())
+            {
+              packed.blockCodes.push_back (PackedFlagMap::ABSENT);
+              continue;
+            }
+          if (cutIndex > 0)
+            {
+              auto previousFlags = flagMap.at (cutIndex - 1).find (collection);
+              if (previousFlags != flagMap.at (cutIndex - 1).end () && previousFlags->second == flags->second)
+                {
+                  packed.blockCodes.push_back (PackedFlagMap::SAME_AS_PREVIOUS_CUT);
+                  continue;
+                }
+            }
+          packed.blockCodes.push_back (PackedFlagMap::STORED);
+          packed.blockSizes.push_back (flags->second.size ());
+          for (const auto &flag : flags->second)
+            {
+              packed.flags.push_back (flag.first);
+              packed.flags.push_back (flag.second);
+            }
+        }
+    }
+}
+
+/**
+ * Unpacks object flags packed by packObjectFlags.
+ *
+ * @param  packed      packed object flags
+ * @param  collections collections whose flags were packed, in the same order
+ * @param  flagMap     object flags for each cut which are filled
+ */
+void
+anatools::unpackObjectFlags (const PackedFlagMap &packed, const vector<string> &collections, FlagMap &flagMap)
+{
+  flagMap.clear ();
+  if (collections.empty ())
+    return;
+  flagMap.resize (packed.blockCodes.size () / collections.size ());
+
+  unsigned block = 0, bit = 0;
+  for (unsigned i = 0; i != packed.blockCodes.size (); i++)
+    {
+      unsigned cutIndex = i / collections.size ();
+      const string &collection = collections.at (i % collections.size ());
+      if (packed.blockCodes.at (i) == PackedFlagMap::SAME_AS_PREVIOUS_CUT)
+        flagMap.at (cutIndex)[collection] = flagMap.at (cutIndex - 1).at (collection);
+      else if (packed.blockCodes.at (i) == PackedFlagMap::STORED)
+        {
+          vector<pair<bool, bool> > &flags = flagMap.at (cutIndex)[collection];
+          for (unsigned j = 0; j != packed.blockSizes.at (block); j++, bit += 2)
+            flags.emplace_back (packed.flags.at (bit), packed.flags.at (bit + 1));
+          block++;
+        }
+    }
+}
+
+/**
+ * Retrieves the packed object flags for one cut and collection.
+ *
+ * Only the block sizes of the preceding blocks are read, so this is much
+ * cheaper than unpacking all of the flags.
+ *
+ * @param  packed          packed object flags
+ * @param  nCollections    number of collections whose flags were packed
+ * @param  cutIndex        index of the cut
+ * @param  collectionIndex index of the collection
+ * @param  flags           flag and validity of each object which are filled
+ * @return whether there are flags for this cut and collection
+ */
+bool
+anatools::getObjectFlags (const PackedFlagMap &packed, const unsigned nCollections, const unsigned cutIndex, const unsigned collectionIndex, vector<pair<bool, bool> > &flags)
+{
+  flags.clear ();
+  unsigned target = cutIndex * nCollections + collectionIndex;
+  if (collectionIndex >= nCollections || target >= packed.blockCodes.size () || packed.blockCodes.at (target) == PackedFlagMap::ABSENT)
+    return false;
+
+  // Find the last stored block for this collection at or before the cut.
+  unsigned block = 0, bit = 0, blockBit = 0, blockSize = 0;
+  for (unsigned i = 0; i <= target; i++)
+    {
+      if (packed.blockCodes.at (i) != PackedFlagMap::STORED)
+        continue;
+      if (i % nCollections == collectionIndex)
+        {
+          blockBit = bit;
+          blockSize = packed.blockSizes.at (block);
+        }
+      bit += 2 * packed.blockSizes.at (block++);
+    }
+
+  for (unsigned j = 0; j != blockSize; j++, blockBit += 2)
+    flags.emplace_back (packed.flags.at (blockBit), packed.flags.at (blockBit + 1));
+  return true;
+}
+
+/**
+ * Returns the compiled accessor for a member of a class, if one was generated.
+ *
+ * The table is filled once, on the first call, and is only read afterward.
+ *
+ * @param  type   string giving the class, e.g., "osu::Muon"
+ * @param  member string giving the member, e.g., "pt"
+ * @return accessor for the member, or NULL if reflection must be used instead
+ */
+anatools::Accessor
+anatools::getAccessor (const string &type, const string &member)
+{
+  static const AccessorTable accessorTable = [] ()
+    {
+      AccessorTable table;
+      fillAccessorTable (table);
+      return table;
+    } ();
+
+  auto members = accessorTable.find (type);
+  if (members == accessorTable.end ())
+    return NULL;
+  auto accessor = members->second.find (member);
+  return (accessor != members->second.end () ? accessor->second : NULL);
+}
+
 #ifdef ROOT6
+  // Converts the value of one of the arithmetic types which members may have
+  // into a double. Returns false if the type is not recognized.
+  static bool
+  arithmeticValue (const string &type, const void * const address, double &value)
+  {
+    if (type == "float")
+      value = *((const float *) address);
+    else if (type == "double")
+      value = *((const double *) address);
+    else if (type == "long double")
+      value = *((const long double *) address);
+    else if (type == "char")
+      value = *((const char *) address);
+    else if (type == "int")
+      value = *((const int *) address);
+    else if (type == "unsigned")
+      value = *((const unsigned *) address);
+    else if (type == "unsigned short")
+      value = *((const unsigned short *) address);
+    else if (type == "unsigned long")
+      value = *((const unsigned long *) address);
+    else if (type == "bool")
+      value = *((const bool *) address);
+    else if (type == "unsigned int")
+      value = *((const unsigned int *) address);
+    else if (type == "unsigned short int")
+      value = *((const unsigned short int *) address);
+    else if (type == "unsigned long int")
+      value = *((const unsigned long int *) address);
+    else if (type == "signed char")
+      value = *((const signed char *) address);
+    else if (type == "unsigned char")
+      value = *((const unsigned char *) address);
+    else
+      return false;
+    return true;
+  }
+
+  static bool
+  isArithmetic (const string &type)
+  {
+    const long double zero = 0.0;
+    double value;
+    return arithmeticValue (type, &zero, value);
+  }
+
   double
-  anatools::getMember (const string &type, void *obj, const string &member, map<pair<string, string>, pair<string, void (*) (void *, int, void **, void *)> > * functionLookupTable)
+  anatools::getMember (const string &type, void *obj, const string &member, FunctionLookupTable * functionLookupTable)
   {
-    const pair<string, string> typeAndMember (type, member);
+    const Accessor accessor = getAccessor (type, member);
+    if (accessor)
+      return accessor (obj);
+
     double value = INVALID_VALUE;
-    string memberType = "";
-    anatools::ObjectWithDict * retObj = NULL;
-    void *retObjAdd = NULL;
-    if (functionLookupTable && functionLookupTable->count (typeAndMember))
-      {
-        memberType = functionLookupTable->at (typeAndMember).first;
-        if (memberType == "float")
-          retObjAdd = (void *) new float[1];
-        else if (memberType == "double")
-          retObjAdd = (void *) new double[1];
-        else if (memberType == "long double")
-          retObjAdd = (void *) new long double[1];
-        else if (memberType == "char")
-          retObjAdd = (void *) new char[1];
-        else if (memberType == "int")
-          retObjAdd = (void *) new int[1];
-        else if (memberType == "unsigned")
-          retObjAdd = (void *) new unsigned[1];
-        else if (memberType == "unsigned short")
-          retObjAdd = (void *) new unsigned short[1];
-        else if (memberType == "unsigned long")
-          retObjAdd = (void *) new unsigned long[1];
-        else if (memberType == "bool")
-          retObjAdd = (void *) new bool[1];
-        else if (memberType == "unsigned int")
-          retObjAdd = (void *) new unsigned int[1];
-        else if (memberType == "unsigned short int")
-          retObjAdd = (void *) new unsigned short int[1];
-        else if (memberType == "unsigned long int")
-          retObjAdd = (void *) new unsigned long int[1];
-        else if (memberType == "signed char")
-          retObjAdd = (void *) new signed char[1];
-        else if (memberType == "unsigned char")
-          retObjAdd = (void *) new unsigned char[1];
-        (*functionLookupTable->at (typeAndMember).second) (obj, 0, NULL, retObjAdd);
-      }
-    else
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members which were already found through reflection are read without it,
+    // and without allocating: a function is called with its return value
+    // written into a buffer on the stack, and any other member is read at its
+    // offset within the object.
+    ////////////////////////////////////////////////////////////////////////////
+    if (functionLookupTable)
       {
-        anatools::TypeWithDict t = anatools::TypeWithDict::byName (type);
-        anatools::ObjectWithDict *o = new anatools::ObjectWithDict (t, obj);
-        try
-          {
-            retObj = getMember (t, t, *o, member, memberType, functionLookupTable);
-            if (retObj)
-              retObjAdd = retObj->address ();
-          }
-        catch (...)
+        auto members = functionLookupTable->find (type);
+        if (members != functionLookupTable->end ())
           {
-            edm::LogInfo ("CommonUtils") << "Unable to access member \"" << member << "\" from \"" << type << "\".";
-            if (o)
-              delete o;
-            if (retObj)
-              delete retObj;
-            return value;
+            auto reflectedMember = members->second.find (member);
+            if (reflectedMember != members->second.end ())
+              {
+                const ReflectedMember &m = reflectedMember->second;
+                long double buffer;  // large enough for any arithmetic type
+                const void *address = &buffer;
+                if (m.function)
+                  (*m.function) (obj, 0, NULL, &buffer);
+                else
+                  address = (const char *) obj + m.offset;
+                arithmeticValue (m.type, address, value);
+                return value;
+              }
           }
-        if (o)
-          delete o;
       }
+    ////////////////////////////////////////////////////////////////////////////
 
-    if (retObjAdd)
+    string memberType = "";
+    anatools::TypeWithDict t = anatools::TypeWithDict::byName (type);
+    anatools::ObjectWithDict o (t, obj);
+    anatools::ObjectWithDict * retObj = NULL;
+    try
       {
-        if (memberType == "float")
-          {
-            value = *((float *) retObjAdd);
-            if (!retObj)
-              delete[] ((float *) retObjAdd);
-          }
-        else if (memberType == "double")
-          {
-            value = *((double *) retObjAdd);
-            if (!retObj)
-              delete[] ((double *) retObjAdd);
-          }
-        else if (memberType == "long double")
-          {
-            value = *((long double *) retObjAdd);
-            if (!retObj)
-              delete[] ((long double *) retObjAdd);
-          }
-        else if (memberType == "char")
-          {
-            value = *((char *) retObjAdd);
-            if (!retObj)
-              delete[] ((char *) retObjAdd);
-          }
-        else if (memberType == "int")
-          {
-            value = *((int *) retObjAdd);
-            if (!retObj)
-              delete[] ((int *) retObjAdd);
-          }
-        else if (memberType == "unsigned")
-          {
-            value = *((unsigned *) retObjAdd);
-            if (!retObj)
-              delete[] ((unsigned *) retObjAdd);
-          }
-        else if (memberType == "unsigned short")
-          {
-            value = *((unsigned short *) retObjAdd);
-            if (!retObj)
-              delete[] ((unsigned short *) retObjAdd);
-          }
-        else if (memberType == "unsigned long")
-          {
-            value = *((unsigned long *) retObjAdd);
-            if (!retObj)
-              delete[] ((unsigned long *) retObjAdd);
-          }
-        else if (memberType == "bool")
-          {
-            value = *((bool *) retObjAdd);
-            if (!retObj)
-              delete[] ((bool *) retObjAdd);
-          }
-        else if (memberType == "unsigned int")
-          {
-            value = *((unsigned int *) retObjAdd);
-            if (!retObj)
-              delete[] ((unsigned int *) retObjAdd);
-          }
-        else if (memberType == "unsigned short int")
-          {
-            value = *((unsigned short int *) retObjAdd);
-            if (!retObj)
-              delete[] ((unsigned short int *) retObjAdd);
-          }
-        else if (memberType == "unsigned long int")
-          {
-            value = *((unsigned long int *) retObjAdd);
-            if (!retObj)
-              delete[] ((unsigned long int *) retObjAdd);
-          }
-        else if (memberType == "signed char")
-          {
-            value = *((signed char *) retObjAdd);
-            if (!retObj)
-              delete[] ((signed char *) retObjAdd);
-          }
-        else if (memberType == "unsigned char")
-          {
-            value = *((unsigned char *) retObjAdd);
-            if (!retObj)
-              delete[] ((unsigned char *) retObjAdd);
-          }
-        else
-          edm::LogWarning ("CommonUtils") << "\"" << member << "\" has unrecognized type \"" << memberType << "\".";
+        retObj = getMember (t, t, o, member, memberType, functionLookupTable);
+      }
+    catch (...)
+      {
+        edm::LogInfo ("CommonUtils") << "Unable to access member \"" << member << "\" from \"" << type << "\".";
         if (retObj)
           delete retObj;
+        return value;
+      }
+    if (!retObj)
+      {
+        edm::LogInfo ("CommonUtils") << "Unable to access member \"" << member << "\" from \"" << type << "\".";
+        return value;
+      }
+
+    if (arithmeticValue (memberType, retObj->address (), value))
+      {
+        // A member found within the object itself, e.g., a data member or a
+        // chain of them, is at the same offset in every object of this type.
+        // Functions were already added to the table while they were found.
+        const char * const address = (const char *) retObj->address ();
+        if (functionLookupTable && address >= (const char *) obj && address < (const char *) obj + t.size ())
+          (*functionLookupTable)[type][member] = {memberType, NULL, address - (const char *) obj};
       }
     else
-      edm::LogInfo ("CommonUtils") << "Unable to access member \"" << member << "\" from \"" << type << "\".";
+      edm::LogWarning ("CommonUtils") << "\"" << member << "\" has unrecognized type \"" << memberType << "\".";
+    delete retObj;
 
     return value;
   }
 
   anatools::ObjectWithDict *
-  anatools::getMember (const anatools::TypeWithDict &tDerived, const anatools::TypeWithDict &t, const anatools::ObjectWithDict &o, const string &member, string &memberType, map<pair<string, string>, pair<string, void (*) (void *, int, void **, void *)> > * functionLookupTable)
+  anatools::getMember (const anatools::TypeWithDict &tDerived, const anatools::TypeWithDict &t, const anatools::ObjectWithDict &o, const string &member, string &memberType, FunctionLookupTable * functionLookupTable)
   {
     string typeName = t.name ();
     size_t dot = member.find ('.'),
@@ -540,8 +725,8 @@ anatools::getRequiredCollections (const unordered_set<string> &objectsToGet, Col
       return (new anatools::ObjectWithDict (o.get (member)));
     else if (functionMember)
       {
-        if (functionLookupTable)
-          (*functionLookupTable)[make_pair (tDerived.name (), member)] = make_pair (memberType, functionMember.address ());
+        if (functionLookupTable && isArithmetic (memberType))
+          (*functionLookupTable)[tDerived.name ()][member] = {memberType, functionMember.address (), 0};
         return invoke (memberType, o, functionMember);
       }
     else
@@ -940,6 +1125,13 @@ anatools::getAllTokens (const edm::ParameterSet &collections, edm::ConsumesColle
       for (const auto &collection : collections.getParameter<vector<edm::InputTag> > ("eventvariables"))
         tokens.eventvariables.push_back (cc.consumes<osu::Eventvariable> (collection));
     }
+  if (collections.exists ("selectedIndices"))
+    {
+      const edm::ParameterSet &selectedIndices = collections.getParameter<edm::ParameterSet> ("selectedIndices");
+      tokens.selectedIndices.clear ();
+      for (const auto &collection : selectedIndices.getParameterNamesForType<edm::InputTag> ())
+        tokens.selectedIndices[collection] = cc.consumes<vector<unsigned> > (selectedIndices.getParameter<edm::InputTag> (collection));
+    }
 }
 
 bool
@@ -4,6 +4,13 @@ EventVariableProducer::EventVariableProducer(const edm::ParameterSet &cfg) :
   collections_  (cfg.getParameter<edm::ParameterSet>  ("collections"))
 {
   produces<EventVariableProducerPayload> ("eventvariables");
+
+  if (collections_.exists ("selectedIndices"))
+    {
+      const edm::ParameterSet &selectedIndices = collections_.getParameter<edm::ParameterSet> ("selectedIndices");
+      for (const auto &collection : selectedIndices.getParameterNamesForType<edm::InputTag> ())
+        selectedIndicesTokens_[collection] = consumes<vector<unsigned> > (selectedIndices.getParameter<edm::InputTag> (collection));
+    }
 }
 
 EventVariableProducer::~EventVariableProducer()
@@ -34,3 +41,14 @@ EventVariableProducer::filter (edm::Event &event, const edm::EventSetup &setup)
 
   return filterDecision;
 }
+
+void
+EventVariableProducer::getSelectedIndices (const unordered_set<string> &objectsToGet, const edm::Event &event, unordered_map<string, edm::Handle<vector<unsigned> > > &selectedIndices) const
+{
+  selectedIndices.clear ();
+  for (const auto &token : selectedIndicesTokens_)
+    {
+      if (VEC_CONTAINS (objectsToGet, token.first))
+        event.getByToken (token.second, selectedIndices[token.first]);
+    }
+}
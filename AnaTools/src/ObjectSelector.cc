@@ -1,7 +1,8 @@
 #include "OSUT3Analysis/AnaTools/interface/ObjectSelector.h"
 
 // The object selector for beamspots is a special case because beamspots are
-// not stored in a vector.
+// not stored in a vector. There is at most one beamspot to copy, so it is
+// always copied rather than selected by index.
 
 #if IS_VALID(beamspots)
   template<>
@@ -10,17 +11,25 @@
     collectionToFilter_  (cfg.getParameter<string>             ("collectionToFilter")),
     originalCollection_  (cfg.getParameter<edm::InputTag>      ("originalCollection")),
     cutDecisions_        (cfg.getParameter<edm::InputTag>      ("cutDecisions")),
-    firstEvent_          (true)
+    firstEvent_          (true),
+    copyObjects_         (true),
+    saveOriginalFormat_  (cfg.exists ("saveOriginalFormat") ? cfg.getParameter<bool> ("saveOriginalFormat") : true),
+    collectionIndex_     (-1),
+    nCollections_        (0),
+    nCuts_               (0)
   {
     // Retrieve the InputTag for the collection which is to be filtered.
     collection_ = collections_.getParameter<edm::InputTag> (collectionToFilter_);
 
     produces<osu::Beamspot> (collection_.instance ());
-    produces<TYPE(beamspots)> (ORIGINAL_FORMAT);
+    if (saveOriginalFormat_)
+      produces<TYPE(beamspots)> (ORIGINAL_FORMAT);
 
     singletonToken_ = consumes<osu::Beamspot> (collection_);
-    singletonOrigToken_ = consumes<TYPE(beamspots)> (originalCollection_);
+    if (saveOriginalFormat_)
+      singletonOrigToken_ = consumes<TYPE(beamspots)> (originalCollection_);
     cutDecisionsToken_ = consumes<CutCalculatorPayload> (cutDecisions_);
+    cutSchemaToken_ = consumes<CutSchema, edm::InRun> (cutDecisions_);
   }
 
   template<> bool
@@ -31,11 +40,12 @@
     // there is a problem.
     //////////////////////////////////////////////////////////////////////////////
     event.getByToken (singletonToken_, singleton);
-    event.getByToken (singletonOrigToken_, singletonOrig);
+    if (saveOriginalFormat_)
+      event.getByToken (singletonOrigToken_, singletonOrig);
     event.getByToken (cutDecisionsToken_, cutDecisions);
     if (firstEvent_ && !singleton.isValid ())
       clog << "WARNING: failed to retrieve requested collection from the event." << endl;
-    if (firstEvent_ && !singletonOrig.isValid ())
+    if (firstEvent_ && saveOriginalFormat_ && !singletonOrig.isValid ())
       clog << "WARNING: failed to retrieve original collection from the event." << endl;
     if (firstEvent_ && !cutDecisions.isValid ())
       clog << "WARNING: failed to retrieve cut decisions from the event." << endl;
@@ -48,31 +58,28 @@
     //////////////////////////////////////////////////////////////////////////////
     unique_ptr<osu::Beamspot> pl_ = unique_ptr<osu::Beamspot> (new osu::Beamspot ());
     unique_ptr<TYPE(beamspots)> plO_ = unique_ptr<TYPE(beamspots)> (new TYPE(beamspots) ());
-    if (singleton.isValid () && singletonOrig.isValid())
+    if (singleton.isValid () && (!saveOriginalFormat_ || singletonOrig.isValid ()))
       {
         const osu::Beamspot * const object = &(*singleton);
-        const TYPE(beamspots) * const objOrig = &(*singletonOrig);
         unsigned iObject = 0;
         bool passes = true;
 
-        if (cutDecisions.isValid ())
-          {
-            for (int iCut = cutDecisions->cumulativeObjectFlags.size () - 1; iCut >= 0; iCut--)
-              {
-                passes = (cutDecisions->cumulativeObjectFlags.at (iCut).at (collectionToFilter_).at (iObject).second ? cutDecisions->cumulativeObjectFlags.at (iCut).at (collectionToFilter_).at (iObject).first : false);
-                break;
-              }
-          }
+        vector<pair<bool, bool> > flags;
+        if (cutDecisions.isValid () && nCuts_ && collectionIndex_ >= 0
+         && anatools::getObjectFlags (cutDecisions->cumulativeObjectFlags, nCollections_, nCuts_ - 1, collectionIndex_, flags))
+          passes = (flags.at (iObject).second ? flags.at (iObject).first : false);
         if (passes)
           {
             *pl_ = *object;
-            *plO_ = *objOrig;
+            if (saveOriginalFormat_)
+              *plO_ = *singletonOrig;
           }
       }
     //////////////////////////////////////////////////////////////////////////////
 
     event.put (std::move (pl_),  collection_.instance ());
-    event.put (std::move (plO_), ORIGINAL_FORMAT);
+    if (saveOriginalFormat_)
+      event.put (std::move (plO_), ORIGINAL_FORMAT);
     pl_.reset ();
     plO_.reset ();
     firstEvent_ = false;
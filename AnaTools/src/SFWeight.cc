@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "OSUT3Analysis/AnaTools/interface/SFWeight.h"
 
 
@@ -580,6 +582,91 @@ RecoMuonWeight::~RecoMuonWeight ()
 
 
 
+GraphSFWeight::GraphSFWeight (const vector<TGraphAsymmErrors *> &graphs) :
+  nEras_ (graphs.size ()),
+  binWidth_ (0.0)
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // The value of an era at x is that of its first point whose x-errors contain
+  // x, not including the edges, or of its last point if there is none. Since
+  // this can only change at the bin edges of one of the eras, it is tabulated
+  // once for every edge and for every bin between two neighboring edges.
+  //////////////////////////////////////////////////////////////////////////////
+  for (const auto &graph : graphs)
+    for (int i = 0; i < graph->GetN (); i++)
+      {
+        edges_.push_back (graph->GetX ()[i] - graph->GetErrorXlow (i));
+        edges_.push_back (graph->GetX ()[i] + graph->GetErrorXhigh (i));
+      }
+  sort (edges_.begin (), edges_.end ());
+  edges_.erase (unique (edges_.begin (), edges_.end ()), edges_.end ());
+
+  auto eraValues = [&] (const double x) {
+    vector<pair<double, double> > row;
+    for (const auto &graph : graphs)
+      {
+        int iPoint = 0;
+        while (iPoint < graph->GetN () - 1
+            && !(x < graph->GetX ()[iPoint] + graph->GetErrorXhigh (iPoint)
+              && x > graph->GetX ()[iPoint] - graph->GetErrorXlow (iPoint)))
+          iPoint++;
+        row.push_back (make_pair (graph->GetY ()[iPoint], graph->GetErrorYhigh (iPoint)));
+      }
+    return row;
+  };
+  for (unsigned i = 0; i < edges_.size (); i++)
+    {
+      rows_.push_back (eraValues (edges_.at (i)));
+      if (i + 1 < edges_.size ())
+        rows_.push_back (eraValues (0.5 * (edges_.at (i) + edges_.at (i + 1))));
+    }
+  rows_.push_back (eraValues (edges_.empty () ? 0.0 : edges_.front () - 1.0));
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  // With uniform bins, the bin containing x can be found directly instead of
+  // by a binary search.
+  //////////////////////////////////////////////////////////////////////////////
+  if (edges_.size () > 2)
+    {
+      double width = (edges_.back () - edges_.front ()) / (edges_.size () - 1);
+      bool uniform = true;
+      for (unsigned i = 1; uniform && i < edges_.size (); i++)
+        uniform = fabs (edges_.at (i) - edges_.at (i - 1) - width) < 1.0e-6 * width;
+      if (uniform)
+        binWidth_ = width;
+    }
+  //////////////////////////////////////////////////////////////////////////////
+}
+
+const vector<pair<double, double> > &
+GraphSFWeight::at (const double &x) const
+{
+  if (!(x >= edges_.front () && x <= edges_.back ()))
+    return rows_.back ();
+
+  unsigned i;
+  if (binWidth_ > 0.0)
+    {
+      i = min ((unsigned) ((x - edges_.front ()) / binWidth_), (unsigned) edges_.size () - 1);
+      // correct for any rounding in the division
+      while (i > 0 && x < edges_.at (i))
+        i--;
+      while (i + 1 < edges_.size () && x >= edges_.at (i + 1))
+        i++;
+    }
+  else
+    i = upper_bound (edges_.begin (), edges_.end (), x) - edges_.begin () - 1;
+
+  return rows_.at (x == edges_.at (i) ? 2 * i : 2 * i + 1);
+}
+
+GraphSFWeight::~GraphSFWeight ()
+{
+}
+
+
+
 
 
 /*
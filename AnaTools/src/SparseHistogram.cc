@@ -0,0 +1,106 @@
+#include "OSUT3Analysis/AnaTools/interface/SparseHistogram.h"
+
+SparseHistogram::SparseHistogram (const TAxis &x, const TAxis &y) :
+  axes_ ({x, y}),
+  entries_ (0.0),
+  stats_ (7, 0.0)
+{
+}
+
+SparseHistogram::SparseHistogram (const TAxis &x, const TAxis &y, const TAxis &z) :
+  axes_ ({x, y, z}),
+  entries_ (0.0),
+  stats_ (11, 0.0)
+{
+}
+
+int
+SparseHistogram::FindBin (const double x, const double y, const double z) const
+{
+  const double values[3] = {x, y, z};
+  int bin = 0;
+  for (int i = axes_.size () - 1; i >= 0; i--)
+    bin = bin * (axes_.at (i).GetNbins () + 2) + axes_.at (i).FindFixBin (values[i]);
+  return bin;
+}
+
+void
+SparseHistogram::Fill (const double x, const double y, const double w)
+{
+  fill ({x, y}, w);
+}
+
+void
+SparseHistogram::Fill (const double x, const double y, const double z, const double w)
+{
+  fill ({x, y, z}, w);
+}
+
+void
+SparseHistogram::fill (const vector<double> &values, const double w)
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Mirrors TH2::Fill and TH3::Fill: every fill is an entry, but only those
+  // inside the axes contribute to the statistics, unless TH1::StatOverflows
+  // has been turned on.
+  //////////////////////////////////////////////////////////////////////////////
+  entries_++;
+
+  bool inRange = true;
+  int bin = 0;
+  for (int i = values.size () - 1; i >= 0; i--)
+    {
+      const int axisBin = axes_.at (i).FindFixBin (values.at (i));
+      inRange = inRange && axisBin > 0 && axisBin <= axes_.at (i).GetNbins ();
+      bin = bin * (axes_.at (i).GetNbins () + 2) + axisBin;
+    }
+
+  pair<double, double> &sums = bins_[bin];
+  sums.second += w * w;
+  sums.first += w;
+
+  if (!inRange && !TH1::GetStatOverflows ())
+    return;
+
+  const double x = values.at (0), y = values.at (1);
+  stats_.at (0) += w;
+  stats_.at (1) += w * w;
+  stats_.at (2) += w * x;
+  stats_.at (3) += w * x * x;
+  stats_.at (4) += w * y;
+  stats_.at (5) += w * y * y;
+  stats_.at (6) += w * x * y;
+  if (values.size () > 2)
+    {
+      const double z = values.at (2);
+      stats_.at (7) += w * z;
+      stats_.at (8) += w * z * z;
+      stats_.at (9) += w * x * z;
+      stats_.at (10) += w * y * z;
+    }
+  //////////////////////////////////////////////////////////////////////////////
+}
+
+void
+SparseHistogram::fill (TH1 * const histogram) const
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Writes the accumulated bins into an empty dense histogram with the same
+  // axes. The entries and statistics are set last, since setting the bin
+  // contents resets them.
+  //////////////////////////////////////////////////////////////////////////////
+  if (!histogram)
+    return;
+  if (!histogram->GetSumw2N ())
+    histogram->Sumw2 ();
+  for (const auto &bin : bins_)
+    {
+      histogram->SetBinContent (bin.first, bin.second.first);
+      histogram->GetSumw2 ()->SetAt (bin.second.second, bin.first);
+    }
+
+  vector<double> stats (stats_);
+  histogram->PutStats (stats.data ());
+  histogram->SetEntries (entries_);
+  //////////////////////////////////////////////////////////////////////////////
+}
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <algorithm>
+#include <cctype>
+#include <cstdlib>
 
 #include "DataFormats/Math/interface/deltaR.h"
 #include "DataFormats/Math/interface/normalizedPhi.h"
@@ -15,42 +17,36 @@ ValueLookupTree::ValueLookupTree () :
 }
 
 ValueLookupTree::ValueLookupTree (const Cut &cut) :
-  root_ (insert_ (cut.cutString, NULL)),
+  root_ (parse (cut.cutString)),
   inputCollections_ (cut.inputCollections),
   evaluationError_ (false),
   allCollectionsNonEmpty_ (false)
 {
-  pruneCommas (root_);
-  pruneParentheses (root_);
-  pruneDots (root_);
-
   sort (inputCollections_.begin (), inputCollections_.end ());
+  resolveEventVariables (root_);
+  prepareEvaluation ();
 }
 
 ValueLookupTree::ValueLookupTree (const ValueToPrint &value) :
-  root_ (insert_ (value.valueToPrint, NULL)),
+  root_ (parse (value.valueToPrint)),
   inputCollections_ (value.inputCollections),
   evaluationError_ (false),
   allCollectionsNonEmpty_ (false)
 {
-  pruneCommas (root_);
-  pruneParentheses (root_);
-  pruneDots (root_);
-
   sort (inputCollections_.begin (), inputCollections_.end ());
+  resolveEventVariables (root_);
+  prepareEvaluation ();
 }
 
 ValueLookupTree::ValueLookupTree (const string &expression, const vector<string> &inputCollections) :
-  root_ (insert_ (expression, NULL)),
+  root_ (parse (expression)),
   inputCollections_ (inputCollections),
   evaluationError_ (false),
   allCollectionsNonEmpty_ (false)
 {
-  pruneCommas (root_);
-  pruneParentheses (root_);
-  pruneDots (root_);
-
   sort (inputCollections_.begin (), inputCollections_.end ());
+  resolveEventVariables (root_);
+  prepareEvaluation ();
 }
 
 ValueLookupTree::~ValueLookupTree ()
@@ -100,10 +96,19 @@ ValueLookupTree::evaluationError () const
   return evaluationError_;
 }
 
+string
+ValueLookupTree::print () const
+{
+  return printTree (root_);
+}
+
 void
 ValueLookupTree::insert (const string &cut)
 {
-  root_ = insert_ (cut, NULL);
+  destroy (root_);
+  root_ = parse (cut);
+  resolveEventVariables (root_);
+  prepareEvaluation ();
 }
 
 const vector<Leaf> &
@@ -117,26 +122,19 @@ ValueLookupTree::evaluate ()
   if (values_.empty () && allCollectionsNonEmpty_)
     {
       evaluationError_ = false;
-      uservariablesToDelete_.clear ();
-      eventvariablesToDelete_.clear ();
       for (unsigned i = 0; i < nCombinations_.at (0); i++)
         {
-          objIterators_.clear ();
-          shouldIterate_.clear ();
-          ObjMap objs;
-          unordered_set<string> keys;
-          for (auto collection = inputCollections_.begin (); collection != inputCollections_.end (); collection++)
+          for (unsigned j = 0; j < inputCollections_.size (); j++)
             {
-              unsigned j = collection - inputCollections_.begin (),
-                       localIndex = getLocalIndex (i, j);
-              objs.insert ({*collection, {j, localIndex, getObject (*collection, localIndex)}});
-              keys.insert (*collection);
+              unsigned localIndex = getLocalIndex (i, j);
+              objs_.at (j) = {j, localIndex, getObject (inputCollections_.at (j), localIndex)};
             }
-          if (isUniqueCase (objs, keys)) {
-            values_.push_back (evaluate_ (root_, objs));
+          objIterators_.assign (objIterators_.size (), objs_.size ());
+          if (isUniqueCase ()) {
+            values_.push_back (evaluate_ (root_, 0));
             if (verbose_) {
               cout << "ValueLookupTree::evaluate is adding the Leaf: " << endl;
-              cout << "  " << evaluate_ (root_, objs) << endl;
+              cout << "  " << evaluate_ (root_, 0) << endl;
               cout << "  printNode = " << endl;
               cout << "  " << printNode(root_) << endl;
               cout << "  printValue = " << endl;
@@ -146,14 +144,6 @@ ValueLookupTree::evaluate ()
           } else
             values_.push_back (INVALID_VALUE);
         }
-#if IS_VALID(uservariables)
-      for (auto &uservariable : uservariablesToDelete_)
-        delete ((osu::Uservariable *) uservariable);
-#endif
-#if IS_VALID(eventvariables)
-      for (auto &eventvariable : eventvariablesToDelete_)
-        delete ((osu::Eventvariable *) eventvariable);
-#endif
     }
 
   return values_;
@@ -184,48 +174,94 @@ ValueLookupTree::getLocalIndex (unsigned globalIndex, unsigned collectionIndex)
   //////////////////////////////////////////////////////////////////////////////
 }
 
-set<unsigned>
-ValueLookupTree::getGlobalIndices (unsigned localIndex, const string &singleObjectCollection, string inputLabel) const
+const vector<unsigned> &
+ValueLookupTree::getGlobalIndices (unsigned localIndex, const string &singleObjectCollection, const string &inputLabel) const
 {
   //////////////////////////////////////////////////////////////////////////////
   // Returns the global indices within the composite collection named by the
   // third argument, given a local index within the primitive collection named
   // by the second argument.
   // Using the example from above (in the comments to getLocalIndices()),
-  // the call to getGlobalIndices(0, "muon", "muon-muon") would return the set {0,1,2,3,6}.
+  // the call to getGlobalIndices(0, "muon", "muon-muon") would return {0,1,2,3,6}.
+  // The indices for every local index are found in a single pass over the
+  // combinations the first time a collection is requested in an event, and
+  // are stored in the combination table for the composite collection.
   //////////////////////////////////////////////////////////////////////////////
-  vector<string> singleObjects = anatools::getSingleObjects (inputLabel);
-  set<unsigned> globalIndices;
-  vector<unsigned> nCombinations (singleObjects.size (), 1), collectionSizes;
-  unordered_set<unsigned> singleObjectIndices;
-  for (auto collection = singleObjects.begin (); collection != singleObjects.end (); collection++)
+  static const vector<unsigned> noGlobalIndices;
+
+  getCombinationTable (inputLabel);
+  CombinationTable &table = handles_->combinationTables.at (inputLabel);
+  auto entry = table.globalIndices.find (singleObjectCollection);
+  if (entry == table.globalIndices.end ())
     {
-      unsigned currentSize = getCollectionSize (*collection);
-      for (unsigned i = 0; i < (collection - singleObjects.begin () + 1); i++)
-        nCombinations[i] *= currentSize;
-      collectionSizes.push_back (currentSize);
-      if (*collection == singleObjectCollection)
-        singleObjectIndices.insert (collection - singleObjects.begin ());
+      entry = table.globalIndices.emplace (singleObjectCollection, CombinationTable::GlobalIndices ()).first;
+      for (unsigned i = 0; i < table.singleObjects.size (); i++)
+        {
+          if (table.singleObjects.at (i) == singleObjectCollection)
+            entry->second.singleObjectIndices.push_back (i);
+        }
     }
-  for (const auto &singleObjectIndex : singleObjectIndices)
+  CombinationTable::GlobalIndices &globalIndices = entry->second;
+  if (!globalIndices.isFilled)
     {
-      for (unsigned i = 0; i < nCombinations.at (0); i++)
+      const vector<unsigned> &singleObjectIndices = globalIndices.singleObjectIndices;
+      globalIndices.size = singleObjectIndices.empty () ? 0 : table.collectionSizes.at (singleObjectIndices.at (0));
+      if (globalIndices.indices.size () < globalIndices.size)
+        globalIndices.indices.resize (globalIndices.size);
+      for (unsigned i = 0; i < globalIndices.size; i++)
+        globalIndices.indices.at (i).clear ();
+      for (unsigned i = 0; i < table.nCombinations; i++)
         {
-          if (singleObjectIndex + 1 < singleObjects.size ())
-            {
-              if ((i / nCombinations.at (singleObjectIndex + 1)) % collectionSizes.at (singleObjectIndex) == localIndex)
-                globalIndices.insert (i);
-            }
-          else
+          for (const auto &singleObjectIndex : singleObjectIndices)
             {
-              if (i % collectionSizes.at (singleObjectIndex) == localIndex)
-                globalIndices.insert (i);
+              vector<unsigned> &indices = globalIndices.indices.at ((i / table.strides.at (singleObjectIndex)) % table.collectionSizes.at (singleObjectIndex));
+              if (indices.empty () || indices.back () != i)
+                indices.push_back (i);
             }
         }
+      globalIndices.isFilled = true;
     }
   //////////////////////////////////////////////////////////////////////////////
 
-  return globalIndices;
+  return (localIndex < globalIndices.size ? globalIndices.indices.at (localIndex) : noGlobalIndices);
+}
+
+const CombinationTable &
+ValueLookupTree::getCombinationTable (const string &inputLabel) const
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Returns the table of collection sizes and strides for the composite
+  // collection named by the argument. The table is filled the first time it is
+  // requested in an event and is shared by all trees using the same
+  // collections, since the collection sizes are the same for all of them. It
+  // is only created for the first event; for the following ones, the sizes
+  // are updated in place.
+  //////////////////////////////////////////////////////////////////////////////
+  auto table = handles_->combinationTables.find (inputLabel);
+  if (table == handles_->combinationTables.end ())
+    {
+      table = handles_->combinationTables.emplace (inputLabel, CombinationTable ()).first;
+      table->second.singleObjects = anatools::getSingleObjects (inputLabel);
+      table->second.collectionSizes.resize (table->second.singleObjects.size ());
+      table->second.strides.resize (table->second.singleObjects.size ());
+    }
+  CombinationTable &newTable = table->second;
+  if (newTable.isFilled)
+    return newTable;
+
+  newTable.nCombinations = 1;
+  for (int i = newTable.singleObjects.size () - 1; i >= 0; i--)
+    {
+      newTable.collectionSizes.at (i) = getCollectionSize (newTable.singleObjects.at (i));
+      newTable.strides.at (i) = newTable.nCombinations;
+      newTable.nCombinations *= newTable.collectionSizes.at (i);
+    }
+  for (auto &globalIndices : newTable.globalIndices)
+    globalIndices.second.isFilled = false;
+  newTable.isFilled = true;
+  //////////////////////////////////////////////////////////////////////////////
+
+  return newTable;
 }
 
 unsigned
@@ -241,6 +277,11 @@ ValueLookupTree::getCollectionSize (const string &name) const
     exit(8);
   }
 
+  // Only the selected objects of a collection filtered by indices are visited.
+  auto selectedIndices = handles_->selectedIndices.find (name);
+  if (selectedIndices != handles_->selectedIndices.end () && selectedIndices->second.isValid ())
+    return selectedIndices->second->size ();
+
   if (EQ_VALID(name,beamspots))
     return 1;
   else if (EQ_VALID(name,bxlumis))
@@ -347,176 +388,374 @@ ValueLookupTree::destroy (Node * const x) const
 }
 
 void
-ValueLookupTree::pruneCommas (Node * const tree) const
+ValueLookupTree::resolveEventVariables (Node * const tree) const
 {
   //////////////////////////////////////////////////////////////////////////////
-  // Recursively replaces any commas in the tree with the daughters.
+  // Recursively finds the nodes which refer to event variables, either as
+  // "eventvariable.name" or as a bare name when eventvariables is the only
+  // input collection, and stores the index of each variable in the merged
+  // event variables. Evaluating these nodes is then just an array access.
   //////////////////////////////////////////////////////////////////////////////
-  bool foundComma;
-  do
+  if (!tree)
+    return;
+
+  double x;
+  if (tree->value == "." && tree->branches.size () == 2 && tree->branches.at (0)->value == "eventvariable")
+    tree->eventvariableIndex = anatools::getEventVariableIndex (tree->branches.at (1)->value);
+  else if (tree->branches.empty ()
+        && inputCollections_.size () == 1
+        && inputCollections_.at (0) == "eventvariables"
+        && !isnumber (tree->value, x)
+        && !isCollection (tree->value + "s")
+        && !(tree->parent && tree->parent->value == "."))
+    tree->eventvariableIndex = anatools::getEventVariableIndex (tree->value);
+
+  for (const auto &branch : tree->branches)
+    resolveEventVariables (branch);
+  //////////////////////////////////////////////////////////////////////////////
+}
+
+void
+ValueLookupTree::prepareEvaluation ()
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Everything evaluate() needs which only depends on the tree and on the
+  // input collections is computed here, so that the scratch space is only
+  // ever resized, never rebuilt, during the event loop. The input collections
+  // are sorted, so repeated collections are next to each other.
+  //////////////////////////////////////////////////////////////////////////////
+  firstIndices_.clear ();
+  collectionTypes_.clear ();
+  for (unsigned j = 0; j < inputCollections_.size (); j++)
     {
-      foundComma = false;
-      for (auto branch = tree->branches.begin (); branch != tree->branches.end (); branch++)
-        {
-          pruneCommas (*branch);
-          if ((*branch)->value == ",")
-            {
-              foundComma = true;
-
-              size_t comma = branch - tree->branches.begin ();
-              (*branch)->branches.at (0)->parent = tree;
-              tree->branches.insert (branch + 1, (*branch)->branches.begin (), (*branch)->branches.end ());
-              branch = tree->branches.begin () + comma;
-              tree->branches.erase (branch);
-              branch = tree->branches.begin () + comma + 1;
-            }
-        }
+      firstIndices_.push_back ((j && inputCollections_.at (j) == inputCollections_.at (j - 1)) ? firstIndices_.at (j - 1) : j);
+      collectionTypes_.push_back (getCollectionType (inputCollections_.at (j)));
     }
-  while (foundComma);
+  objs_.assign (inputCollections_.size (), {0, 0, NULL});
+  objIterators_.assign (inputCollections_.size (), inputCollections_.size ());
+  operands_.clear ();
+  operands_.resize (depth (root_));
   //////////////////////////////////////////////////////////////////////////////
 }
 
-void
-ValueLookupTree::pruneParentheses (Node * &tree) const
+unsigned
+ValueLookupTree::depth (const Node * const tree) const
+{
+  if (!tree)
+    return 0;
+  unsigned maxDepth = 0;
+  for (const auto &branch : tree->branches)
+    maxDepth = max (maxDepth, depth (branch));
+  return maxDepth + 1;
+}
+
+Node *
+ValueLookupTree::parse (const string &expression) const
 {
-  pruneParentheses_ (tree);
-  if (!tree->parent)
+  //////////////////////////////////////////////////////////////////////////////
+  // Split the expression into tokens and parse them into a tree. If either
+  // step fails, simply print an error and return NULL. The user can then use
+  // the isValid() method to see if inserting the expression into the tree was
+  // successful.
+  //////////////////////////////////////////////////////////////////////////////
+  vector<Token> tokens;
+  if (!tokenize (expression, tokens))
     {
-      if (tree->value == "()")
-        {
-          tree = tree->branches.at (0);
-          tree->parent = NULL;
-        }
+      clog << "ERROR: failed to parse \"" << expression << "\"" << endl;
+      return NULL;
+    }
+
+  unsigned i = 0;
+  Node *tree = NULL;
+  if (tokens.at (0).type == Token::END)
+    tree = newNode ("");
+  else
+    tree = parseExpression (tokens, i, 0);
+  if (tree && tokens.at (i).type != Token::END)
+    {
+      destroy (tree);
+      tree = NULL;
     }
+  if (!tree)
+    {
+      if (count (expression.begin (), expression.end (), '(') != count (expression.begin (), expression.end (), ')'))
+        clog << "ERROR: missing parentheses in \"" << expression << "\"" << endl;
+      else
+        clog << "ERROR: failed to parse \"" << expression << "\"" << endl;
+      return NULL;
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Parentheses around the entire expression are dropped. Only the first
+  // expression is kept if they enclose several separated by commas.
+  //////////////////////////////////////////////////////////////////////////////
+  if (tree->value == "()")
+    {
+      Node *branch = tree->branches.at (0);
+      tree->branches.erase (tree->branches.begin ());
+      destroy (tree);
+      tree = branch;
+      tree->parent = NULL;
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  return tree;
 }
 
-void
-ValueLookupTree::pruneParentheses_ (Node * const tree) const
+bool
+ValueLookupTree::tokenize (const string &s, vector<Token> &tokens) const
 {
   //////////////////////////////////////////////////////////////////////////////
-  // Recursively replaces any parentheses in the tree with the daughter.
+  // Splits the string into numbers, names, operators and parentheses in a
+  // single pass, taking the longest operator which matches at each position.
+  // A sign directly in front of a number is part of the number if the sign
+  // cannot be a binary operator, as in "pt > -1".
   //////////////////////////////////////////////////////////////////////////////
-  bool foundParenthesis;
-  do
+  static const vector<string> operators = {"||", "&&", "==", "!=", "<=", ">=", "|", "&", "=", "<", ">", "+", "-", "*", "/", "%", "!", ",", "."};
+
+  tokens.clear ();
+  for (size_t i = 0; i < s.length (); )
     {
-      foundParenthesis = false;
-      for (auto branch = tree->branches.begin (); branch != tree->branches.end (); branch++)
+      char c = s.at (i), next = i + 1 < s.length () ? s.at (i + 1) : '\0';
+      if (isspace (c))
         {
-          pruneParentheses_ (*branch);
-          if ((*branch)->value == "()")
-            {
-              foundParenthesis = true;
-
-              size_t parenthesis = branch - tree->branches.begin ();
-              (*branch)->branches.at (0)->parent = tree;
-              tree->branches.insert (branch + 1, (*branch)->branches.begin (), (*branch)->branches.end ());
-              branch = tree->branches.begin () + parenthesis;
-              tree->branches.erase (branch);
-              branch = tree->branches.begin () + parenthesis;
-            }
+          i++;
+          continue;
+        }
+
+      bool operandExpected = tokens.empty ()
+                          || tokens.back ().type == Token::LEFT_PARENTHESIS
+                          || (tokens.back ().type == Token::OPERATOR && tokens.back ().value != "."),
+           startsNumber = isdigit (c)
+                       || (c == '.' && isdigit (next) && operandExpected)
+                       || ((c == '+' || c == '-') && operandExpected && (isdigit (next) || (next == '.' && i + 2 < s.length () && isdigit (s.at (i + 2)))));
+      if (startsNumber)
+        {
+          char *end;
+          strtod (s.c_str () + i, &end);
+          size_t length = end - (s.c_str () + i);
+          if (!length || (i + length < s.length () && (isalnum (s.at (i + length)) || s.at (i + length) == '_')))
+            return false;
+          tokens.push_back ({Token::NUMBER, s.substr (i, length)});
+          i += length;
+        }
+      else if (isalpha (c) || c == '_')
+        {
+          size_t length = 1;
+          while (i + length < s.length () && (isalnum (s.at (i + length)) || s.at (i + length) == '_'))
+            length++;
+          tokens.push_back ({Token::NAME, s.substr (i, length)});
+          i += length;
+        }
+      else if (c == '(' || c == ')')
+        {
+          tokens.push_back ({c == '(' ? Token::LEFT_PARENTHESIS : Token::RIGHT_PARENTHESIS, string (1, c)});
+          i++;
+        }
+      else
+        {
+          auto op = operators.begin ();
+          while (op != operators.end () && s.compare (i, op->length (), *op))
+            op++;
+          if (op == operators.end ())
+            return false;
+          tokens.push_back ({Token::OPERATOR, *op});
+          i += op->length ();
         }
     }
-  while (foundParenthesis);
+  tokens.push_back ({Token::END, ""});
   //////////////////////////////////////////////////////////////////////////////
+
+  return true;
 }
 
-void
-ValueLookupTree::pruneDots (Node * &tree) const
+Node *
+ValueLookupTree::parseExpression (const vector<Token> &tokens, unsigned &i, const int minPrecedence) const
 {
-  pruneDots_ (tree);
-  if (!tree->parent)
+  //////////////////////////////////////////////////////////////////////////////
+  // Precedence climbing: the left operand is extended for as long as the next
+  // token is a binary operator binding at least as tightly as minPrecedence.
+  // All of the binary operators are left-associative.
+  //////////////////////////////////////////////////////////////////////////////
+  Node *tree = parseUnary (tokens, i);
+  while (tree)
     {
-      if (tree->value == "." && !isCollection (tree->branches.at (0)->value + "s"))
+      const Token &op = tokens.at (i);
+      int precedence = op.type == Token::OPERATOR ? binaryPrecedence (op.value) : -1;
+      if (precedence < minPrecedence)
+        break;
+      i++;
+
+      Node *right = parseExpression (tokens, i, precedence + 1);
+      if (!right)
         {
-          tree->branches.at (0)->value += "." + tree->branches.at (1)->value;
-          tree->branches.at (0)->parent = NULL;
-          tree = tree->branches.at (0);
+          destroy (tree);
+          return NULL;
         }
+      tree = newNode (op.value, {tree, right});
     }
+  //////////////////////////////////////////////////////////////////////////////
+
+  return tree;
 }
 
-void
-ValueLookupTree::pruneDots_ (Node * const tree) const
+Node *
+ValueLookupTree::parseUnary (const vector<Token> &tokens, unsigned &i) const
 {
   //////////////////////////////////////////////////////////////////////////////
-  // Recursively replaces any dots in the tree with the concatentation of the
-  // daughter values.
+  // Unary prefix operators bind more tightly than any binary operator, but
+  // less tightly than functions and dots.
   //////////////////////////////////////////////////////////////////////////////
-  bool foundDot;
-  do
+  const Token &token = tokens.at (i);
+  if (token.type == Token::OPERATOR && (token.value == "!" || token.value == "+" || token.value == "-"))
     {
-      foundDot = false;
-      for (auto branch = tree->branches.begin (); branch != tree->branches.end (); branch++)
-        {
-          pruneDots_ (*branch);
-          if ((*branch)->value == "." && (((*branch)->parent && (*branch)->parent->value == ".")
-                                       || !isCollection ((*branch)->branches.at (0)->value + "s")))
-            {
-              foundDot = true;
-
-              size_t dot = branch - tree->branches.begin ();
-              (*branch)->branches.at (0)->value += "." + (*branch)->branches.at (1)->value;
-              (*branch)->branches.at (0)->parent = tree;
-              tree->branches.insert (branch + 1, (*branch)->branches.at (0));
-              branch = tree->branches.begin () + dot;
-              tree->branches.erase (branch);
-              branch = tree->branches.begin () + dot;
-            }
-        }
+      i++;
+      Node *operand = parseUnary (tokens, i);
+      return (operand ? newNode (token.value, {operand}) : NULL);
     }
-  while (foundDot);
   //////////////////////////////////////////////////////////////////////////////
+
+  return parsePrimary (tokens, i);
 }
 
 Node *
-ValueLookupTree::insert_ (const string &cut, Node * const parent) const
+ValueLookupTree::parsePrimary (const vector<Token> &tokens, unsigned &i) const
 {
+  const Token &token = tokens.at (i);
+
   //////////////////////////////////////////////////////////////////////////////
-  // If the given string is missing parentheses, simply print an error and
-  // return NULL. The user can then use the isValid() method to see if
-  // inserting the expression into the tree was successful.
+  // Numbers are simply leaves.
   //////////////////////////////////////////////////////////////////////////////
-  if (splitParentheses (cut))
+  if (token.type == Token::NUMBER)
     {
-      clog << "ERROR: missing parentheses in \"" << cut << "\"" << endl;
-      return NULL;
+      i++;
+      return newNode (token.value);
     }
   //////////////////////////////////////////////////////////////////////////////
 
   //////////////////////////////////////////////////////////////////////////////
-  // Try inserting nodes for each possible operator, in reverse order of
-  // operations. If none of the operators can be inserted, then it means we
-  // have hit a leaf.
+  // Expressions in parentheses are stored under a "()" node, which is removed
+  // when it becomes a branch of another node. Empty parentheses hold an empty
+  // leaf.
+  //////////////////////////////////////////////////////////////////////////////
+  if (token.type == Token::LEFT_PARENTHESIS)
+    {
+      i++;
+      Node *middle = (tokens.at (i).type == Token::RIGHT_PARENTHESIS ? newNode ("") : parseExpression (tokens, i, 0));
+      if (!middle || tokens.at (i).type != Token::RIGHT_PARENTHESIS)
+        {
+          destroy (middle);
+          return NULL;
+        }
+      i++;
+      return newNode ("()", {middle});
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  if (token.type != Token::NAME)
+    return NULL;
+  i++;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // A function is followed by its arguments, usually in parentheses, which
+  // become the branches of the function's node. Without arguments, e.g.,
+  // "invMass > 60", the function has a single empty leaf and acts on the
+  // objects of the input collections.
+  //////////////////////////////////////////////////////////////////////////////
+  if (isFunction (token.value))
+    {
+      const Token::Type next = tokens.at (i).type;
+      Node *arguments = (next == Token::NAME || next == Token::NUMBER || next == Token::LEFT_PARENTHESIS) ? parsePrimary (tokens, i) : newNode ("");
+      return (arguments ? newNode (token.value, {arguments}) : NULL);
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  // A chain of names separated by dots, e.g., "muon.innerTrack.pt", is a
+  // single leaf unless it starts with a collection, in which case the
+  // collection and the rest of the chain are the two branches of a "." node.
+  //////////////////////////////////////////////////////////////////////////////
+  string chain = "";
+  for (; tokens.at (i).type == Token::OPERATOR && tokens.at (i).value == "."; i += 2)
+    {
+      if (tokens.at (i + 1).type != Token::NAME)
+        return NULL;
+      chain += (chain.empty () ? "" : ".") + tokens.at (i + 1).value;
+    }
+  if (chain.empty () || !isCollection (token.value + "s"))
+    return newNode (token.value + (chain.empty () ? "" : "." + chain));
+  return newNode (".", {newNode (token.value), newNode (chain)});
+  //////////////////////////////////////////////////////////////////////////////
+}
+
+Node *
+ValueLookupTree::newNode (const string &value, const vector<Node *> &branches) const
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // Creates a node with the given branches. Any branch which is a "()" node,
+  // or a "," node, is replaced by its own branches, so that, e.g., the
+  // arguments of a function become the branches of the function's node.
   //////////////////////////////////////////////////////////////////////////////
   Node *tree = new Node;
-  tree->parent = parent;
-  if (!(insertBinaryInfixOperator  (cut,  tree,  {","})                           ||
-        insertBinaryInfixOperator  (cut,  tree,  {"||", "|"})                     ||
-        insertBinaryInfixOperator  (cut,  tree,  {"&&", "&"})                     ||
-        insertBinaryInfixOperator  (cut,  tree,  {"==", "!=", "="}, {"<=", ">="}) ||
-        insertBinaryInfixOperator  (cut,  tree,  {"<", "<=", ">", ">="})          ||
-        insertBinaryInfixOperator  (cut,  tree,  {"+", "-"})                      ||
-        insertBinaryInfixOperator  (cut,  tree,  {"*", "/", "%"})                 ||
-        insertUnaryPrefixOperator  (cut,  tree,  {"!", "+", "-"})                           ||
-        insertUnaryPrefixOperator  (cut,  tree,  {"cos", "sin", "tan", "acos", "asin", "atan", "atan2",
+  tree->parent = NULL;
+  tree->value = value;
+  tree->eventvariableIndex = -1;
+  for (const auto &branch : branches)
+    {
+      if (branch->value == "()" || branch->value == ",")
+        {
+          for (const auto &b : branch->branches)
+            {
+              b->parent = tree;
+              tree->branches.push_back (b);
+            }
+          delete branch;
+        }
+      else
+        {
+          branch->parent = tree;
+          tree->branches.push_back (branch);
+        }
+    }
+  //////////////////////////////////////////////////////////////////////////////
+
+  return tree;
+}
+
+int
+ValueLookupTree::binaryPrecedence (const string &op) const
+{
+  if (op == ",")
+    return 0;
+  if (op == "||" || op == "|")
+    return 1;
+  if (op == "&&" || op == "&")
+    return 2;
+  if (op == "==" || op == "!=" || op == "=")
+    return 3;
+  if (op == "<" || op == "<=" || op == ">" || op == ">=")
+    return 4;
+  if (op == "+" || op == "-")
+    return 5;
+  if (op == "*" || op == "/" || op == "%")
+    return 6;
+  return -1;
+}
+
+bool
+ValueLookupTree::isFunction (const string &name) const
+{
+  static const unordered_set<string> functions = {"cos", "sin", "tan", "acos", "asin", "atan", "atan2",
                                                   "cosh", "sinh", "tanh", "acosh", "asinh", "atanh",
                                                   "exp", "ldexp", "log", "log10", "exp2", "expm1", "ilogb", "log1p", "log2", "logb",
                                                   "pow", "sqrt", "cbrt", "hypot",
                                                   "erf", "erfc", "tgamma", "lgamma",
                                                   "ceil", "floor", "fmod", "trunc", "round", "rint", "nearbyint", "remainder", "abs", "fabs",
                                                   "copysign", "nextafter",
-                                                  "fdim", "fmax", "fmin", "max", "min"}) ||
-        insertUnaryPrefixOperator  (cut,  tree,  {"deltaPhi", "dPhi", "normalizedPhi", "compositePhi", "deltaR", "invMass", "number", "transMass", "pT"}) ||
-        insertDots                 (cut,  tree) ||
-        //insertBinaryInfixOperator  (cut,  tree,  {"."})                           ||
-        insertParentheses          (cut,  tree)))
-    {
-      tree->value = cut;
-      anatools::trim (tree->value);
-    }
-  //////////////////////////////////////////////////////////////////////////////
-
-  return tree;
+                                                  "fdim", "fmax", "fmin", "max", "min",
+                                                  "deltaPhi", "dPhi", "normalizedPhi", "compositePhi", "deltaR", "invMass", "number", "transMass", "pT"};
+  return functions.count (name);
 }
 
 string
@@ -550,8 +789,24 @@ ValueLookupTree::printValue (Node* tree) const
 
 }
 
+string
+ValueLookupTree::printTree (const Node * const tree) const
+{
+  if (!tree)
+    return "";
+  string expression = tree->value;
+  if (!tree->branches.empty ())
+    {
+      expression += " (";
+      for (auto branch = tree->branches.begin (); branch != tree->branches.end (); branch++)
+        expression += (branch != tree->branches.begin () ? ", " : "") + printTree (*branch);
+      expression += ")";
+    }
+  return expression;
+}
+
 Leaf
-ValueLookupTree::evaluate_ (const Node * const tree, const ObjMap &objs)
+ValueLookupTree::evaluate_ (const Node * const tree, const unsigned treeDepth)
 {
   //////////////////////////////////////////////////////////////////////////////
   // Do nothing if the tree is null.
@@ -560,17 +815,34 @@ ValueLookupTree::evaluate_ (const Node * const tree, const ObjMap &objs)
     return INVALID_VALUE;
   //////////////////////////////////////////////////////////////////////////////
 
+  //////////////////////////////////////////////////////////////////////////////
+  // The node refers to an event variable whose index was resolved when the
+  // tree was built, so simply return its value for this event.
+  //////////////////////////////////////////////////////////////////////////////
+  if (tree->eventvariableIndex >= 0)
+    return eventvariableLookup (tree->eventvariableIndex);
+  //////////////////////////////////////////////////////////////////////////////
+
   //////////////////////////////////////////////////////////////////////////////
   // The node is not a leaf and its value is an operator. First, evaluate its
   // daughters, then return the result of the operator acting on the daughters.
   //////////////////////////////////////////////////////////////////////////////
   if (!tree->branches.empty ())
     {
-      vector<Leaf> operands;
+      // A dot takes a member of an object directly from the names in its
+      // branches, which need not be copied into operands, since the member
+      // names are often too long to fit in a string without allocating.
+      if (tree->value == "." && tree->branches.size () == 2)
+        return valueLookup (collectionIndex (tree->branches.at (0)->value), tree->branches.at (1)->value);
+
+      // The operands of every node at the same depth share a buffer, which is
+      // only overwritten once the operator has been applied.
+      vector<Leaf> &operands = operands_.at (treeDepth);
+      operands.clear ();
       for (const auto &branch : tree->branches)
-        operands.push_back (evaluate_ (branch, objs));
+        operands.push_back (evaluate_ (branch, treeDepth + 1));
       if (verbose_) cout << "    Debug evalute 0 (no branches) for tree->value = " << tree->value << endl;
-      return evaluateOperator (tree->value, operands, objs);
+      return evaluateOperator (tree->value, operands);
     }
   //////////////////////////////////////////////////////////////////////////////
 
@@ -587,7 +859,7 @@ ValueLookupTree::evaluate_ (const Node * const tree, const ObjMap &objs)
                            << ", value = " << value << endl;
         return value;
       }
-      else if (isCollection (tree->value + "s") || (tree->parent && tree->parent->value == ".")) {
+      else if (isCollection (plural (tree->value)) || (tree->parent && tree->parent->value == ".")) {
         if (verbose_) cout << "    Debug evalute 2 for tree->value = " << tree->value
              << ", value = " << value << endl;
         return tree->value;
@@ -599,7 +871,7 @@ ValueLookupTree::evaluate_ (const Node * const tree, const ObjMap &objs)
                                << ", calling valueLookup for value: " << tree->value
                                << ", collection: " << inputCollections_.at (0)
                                << endl;
-            return valueLookup (inputCollections_.at (0), objs, tree->value);
+            return valueLookup (0, tree->value);
           }
           clog << "ERROR: cannot infer ownership of \"" << tree->value << "\"" << endl;
           evaluationError_ = true;
@@ -610,7 +882,7 @@ ValueLookupTree::evaluate_ (const Node * const tree, const ObjMap &objs)
 }
 
 Leaf
-ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operands, const ObjMap &objs)
+ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operands)
 {
   // Tries to return the result of operating on the operands. Prints out a
   // warning, sets evaluationError_ to true, and returns the minimum unsigned
@@ -759,8 +1031,8 @@ ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operand
       else if (op == "abs" || op == "fabs")
         return (fabs (boost::get<double> (operands.at (0))));
       else if (op == "deltaPhi")
-        return deltaPhi (valueLookup (boost::get<string> (operands.at (0)) + "s", objs, "phi"),
-                         valueLookup (boost::get<string> (operands.at (1)) + "s", objs, "phi"));
+        return deltaPhi (valueLookup (collectionIndex (boost::get<string> (operands.at (0))), "phi"),
+                         valueLookup (collectionIndex (boost::get<string> (operands.at (1))), "phi"));
       else if (op == "dPhi")
         return deltaPhi (boost::get<double> (operands.at (0)), boost::get<double> (operands.at (1)));
       else if (op == "normalizedPhi")
@@ -769,10 +1041,10 @@ ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operand
         {
           double px0, px1, py0, py1, phi;
 
-          px0 = valueLookup (boost::get<string> (operands.at (0)) + "s", objs, "px");
-          px1 = valueLookup (boost::get<string> (operands.at (1)) + "s", objs, "px");
-          py0 = valueLookup (boost::get<string> (operands.at (0)) + "s", objs, "py");
-          py1 = valueLookup (boost::get<string> (operands.at (1)) + "s", objs, "py");
+          px0 = valueLookup (collectionIndex (boost::get<string> (operands.at (0))), "px");
+          px1 = valueLookup (collectionIndex (boost::get<string> (operands.at (1))), "px");
+          py0 = valueLookup (collectionIndex (boost::get<string> (operands.at (0))), "py");
+          py1 = valueLookup (collectionIndex (boost::get<string> (operands.at (1))), "py");
 
           phi = acos ((px0 + px1) / hypot (px0 + px1, py0 + py1));
           if ((py0 + py1) < 0.0)
@@ -784,10 +1056,10 @@ ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operand
         {
           double eta0, phi0, eta1, phi1;
 
-          eta0 = valueLookup (boost::get<string> (operands.at (0)) + "s", objs, "eta");
-          phi0 = valueLookup (boost::get<string> (operands.at (0)) + "s", objs, "phi", false);
-          eta1 = valueLookup (boost::get<string> (operands.at (1)) + "s", objs, "eta");
-          phi1 = valueLookup (boost::get<string> (operands.at (1)) + "s", objs, "phi", false);
+          eta0 = valueLookup (collectionIndex (boost::get<string> (operands.at (0))), "eta");
+          phi0 = valueLookup (collectionIndex (boost::get<string> (operands.at (0))), "phi", false);
+          eta1 = valueLookup (collectionIndex (boost::get<string> (operands.at (1))), "eta");
+          phi1 = valueLookup (collectionIndex (boost::get<string> (operands.at (1))), "phi", false);
 
           return deltaR (eta0, phi0, eta1, phi1);
         }
@@ -797,20 +1069,20 @@ ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operand
 
           for (const auto &operand : operands)
             {
-              energy += valueLookup (boost::get<string> (operand) + "s", objs, "energy");
-              px += valueLookup (boost::get<string> (operand) + "s", objs, "px", false);
-              py += valueLookup (boost::get<string> (operand) + "s", objs, "py", false);
-              pz += valueLookup (boost::get<string> (operand) + "s", objs, "pz", false);
+              energy += valueLookup (collectionIndex (boost::get<string> (operand)), "energy");
+              px += valueLookup (collectionIndex (boost::get<string> (operand)), "px", false);
+              py += valueLookup (collectionIndex (boost::get<string> (operand)), "py", false);
+              pz += valueLookup (collectionIndex (boost::get<string> (operand)), "pz", false);
             }
 
           return sqrt (energy * energy - px * px - py * py - pz * pz);
         }
       else if (op == "transMass")
         {
-          double pt0 = valueLookup (boost::get<string> (operands.at (0)) + "s", objs, "pt", false),
-                 pt1 = valueLookup (boost::get<string> (operands.at (1)) + "s", objs, "pt", false),
-                 dPhi = deltaPhi (valueLookup (boost::get<string> (operands.at (0)) + "s", objs, "phi"),
-                                  valueLookup (boost::get<string> (operands.at (1)) + "s", objs, "phi"));
+          double pt0 = valueLookup (collectionIndex (boost::get<string> (operands.at (0))), "pt", false),
+                 pt1 = valueLookup (collectionIndex (boost::get<string> (operands.at (1))), "pt", false),
+                 dPhi = deltaPhi (valueLookup (collectionIndex (boost::get<string> (operands.at (0))), "phi"),
+                                  valueLookup (collectionIndex (boost::get<string> (operands.at (1))), "phi"));
 
           return sqrt (2.0 * pt0 * pt1 * (1 - cos (dPhi)));
         }
@@ -820,15 +1092,13 @@ ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operand
 
           for (const auto &operand : operands)
             {
-              px += valueLookup (boost::get<string> (operand) + "s", objs, "px");
-              py += valueLookup (boost::get<string> (operand) + "s", objs, "py", false);
+              px += valueLookup (collectionIndex (boost::get<string> (operand)), "px");
+              py += valueLookup (collectionIndex (boost::get<string> (operand)), "py", false);
             }
           return hypot(px,py);
         }
       else if (op == "number")
-        return getCollectionSize (boost::get<string> (operands.at (0)) + "s");
-      else if (op == ".")
-        return valueLookup (boost::get<string> (operands.at (0)) + "s", objs, boost::get<string> (operands.at (1)));
+        return getCollectionSize (plural (boost::get<string> (operands.at (0))));
     }
   catch (...)
     {
@@ -848,68 +1118,63 @@ ValueLookupTree::evaluateOperator (const string &op, const vector<Leaf> &operand
 void *
 ValueLookupTree::getObject (const string &name, const unsigned i)
 {
+  // The i-th selected object of a collection filtered by indices is at the
+  // i-th selected index.
+  auto selectedIndices = handles_->selectedIndices.find (name);
+  const unsigned j = (selectedIndices != handles_->selectedIndices.end () && selectedIndices->second.isValid () ? selectedIndices->second->at (i) : i);
+
   if (EQ_VALID(name,beamspots))
     return ((void *) &(*handles_->beamspots));
   else if (EQ_VALID(name,bxlumis))
-    return ((void *) &handles_->bxlumis->at (i));
+    return ((void *) &handles_->bxlumis->at (j));
   else if (EQ_VALID(name,cschits))
-    return ((void *) &handles_->cschits->at (i));
+    return ((void *) &handles_->cschits->at (j));
   else if (EQ_VALID(name,cscsegs))
-    return ((void *) &handles_->cscsegs->at (i));
+    return ((void *) &handles_->cscsegs->at (j));
   else if (EQ_VALID(name,dtsegs))
-    return ((void *) &handles_->dtsegs->at (i));
+    return ((void *) &handles_->dtsegs->at (j));
   else if (EQ_VALID(name,electrons))
-    return ((void *) &handles_->electrons->at (i));
+    return ((void *) &handles_->electrons->at (j));
   else if (EQ_VALID(name,events))
-    return ((void *) &handles_->events->at (i));
+    return ((void *) &handles_->events->at (j));
   else if (EQ_VALID(name,genjets))
-    return ((void *) &handles_->genjets->at (i));
+    return ((void *) &handles_->genjets->at (j));
   else if (EQ_VALID(name,generatorweights))
     return ((void *) &(*handles_->generatorweights));
   else if (EQ_VALID(name,jets))
-    return ((void *) &handles_->jets->at (i));
+    return ((void *) &handles_->jets->at (j));
   else if (EQ_VALID(name,bjets))
-    return ((void *) &handles_->bjets->at (i));
+    return ((void *) &handles_->bjets->at (j));
   else if (EQ_VALID(name,mcparticles))
-    return ((void *) &handles_->mcparticles->at (i));
+    return ((void *) &handles_->mcparticles->at (j));
   else if (EQ_VALID(name,mets))
-    return ((void *) &handles_->mets->at (i));
+    return ((void *) &handles_->mets->at (j));
   else if (EQ_VALID(name,muons))
-    return ((void *) &handles_->muons->at (i));
+    return ((void *) &handles_->muons->at (j));
   else if (EQ_VALID(name,photons))
-    return ((void *) &handles_->photons->at (i));
+    return ((void *) &handles_->photons->at (j));
   else if (EQ_VALID(name,primaryvertexs))
-    return ((void *) &handles_->primaryvertexs->at (i));
+    return ((void *) &handles_->primaryvertexs->at (j));
   else if (EQ_VALID(name,rpchits))
-    return ((void *) &handles_->rpchits->at (i));
+    return ((void *) &handles_->rpchits->at (j));
   else if (EQ_VALID(name,superclusters))
-    return ((void *) &handles_->superclusters->at (i));
+    return ((void *) &handles_->superclusters->at (j));
   else if (EQ_VALID(name,taus))
-    return ((void *) &handles_->taus->at (i));
+    return ((void *) &handles_->taus->at (j));
   else if (EQ_VALID(name,tracks))
-    return ((void *) &handles_->tracks->at (i));
+    return ((void *) &handles_->tracks->at (j));
   else if (EQ_VALID(name,secondaryTracks))
-    return ((void *) &handles_->secondaryTracks->at (i));
+    return ((void *) &handles_->secondaryTracks->at (j));
   else if (EQ_VALID(name,pileupinfos))
-    return ((void *) &handles_->pileupinfos->at (i));
+    return ((void *) &handles_->pileupinfos->at (j));
+  // The user and event variables are not stored as objects. Event variables
+  // are read from the merged event variables shared by all trees, and user
+  // variables are not yet supported by valueLookup, so there is nothing to
+  // build for either one.
   else if (EQ_VALID(name,uservariables))
-    {
-      //!!!
-      osu::Uservariable *obj = new osu::Uservariable ();
-      for (const auto &handle : handles_->uservariables)
-        obj->insert (handle->begin (), handle->end ());
-      uservariablesToDelete_.push_back (obj);
-      return obj;
-    }
+    return ((void *) &handles_->uservariables);
   else if (EQ_VALID(name,eventvariables))
-    {
-      //!!!
-      osu::Eventvariable *obj = new osu::Eventvariable ();
-      for (const auto &handle : handles_->eventvariables)
-        obj->insert (handle->begin (), handle->end ());
-      eventvariablesToDelete_.push_back (obj);
-      return obj;
-    }
+    return ((void *) &handles_->mergedEventvariables);
   return NULL;
 }
 
@@ -1029,336 +1294,82 @@ ValueLookupTree::isnumber (const string &s, double &x) const
   return !(*p);
 }
 
-bool
-ValueLookupTree::splitParentheses (string s) const
+const string &
+ValueLookupTree::plural (const string &name)
 {
-  // Returns true if the number of left parentheses does not equal the number
-  // of right parentheses.
-
-  int parentheses = 0;
-  for (unsigned i = 0; i < s.length (); i++)
-    {
-      char c = s.at (i);
-      if (c == '(')
-        parentheses++;
-      if (c == ')')
-        parentheses--;
-    }
-  return parentheses;
+  pluralName_.assign (name);
+  pluralName_.push_back ('s');
+  return pluralName_;
 }
 
-pair<size_t, string>
-ValueLookupTree::findFirstOf (const string &s, const vector<string> &targets, const vector<string> &vetoTargets, const size_t pos) const
-{
-  vector<tuple<size_t, size_t, string> > indices;
-  tuple<size_t, size_t, string> firstHit;
-  pair<size_t, string> biggestHit;
-
-  //////////////////////////////////////////////////////////////////////////////
-  // For each of the target strings, find the index of the first instance of
-  // it. Then sort the indices in ascending order.
-  //////////////////////////////////////////////////////////////////////////////
-  for (const auto &target : targets)
-    {
-      size_t index = s.find (target, pos);
-      if (!vetoMatch (s, target, index, vetoTargets))
-        indices.emplace_back (index, index, target);
-    }
-  sort (indices.begin (), indices.end (), anatools::firstOfTupleAscending);
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // If there are no matches, just return string::npos.
-  //////////////////////////////////////////////////////////////////////////////
-  if (indices.empty ())
-    return make_pair (string::npos, "");
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // If there are multiple targets which match at the same position in the
-  // string, then only return the one which matches the most characters.
-  //////////////////////////////////////////////////////////////////////////////
-  firstHit = indices.at (0);
-  for (auto index = indices.begin (); index != indices.end () && get<0> (*index) == get<0> (firstHit); index++)
-    {
-      if (get<2> (*index).length () > biggestHit.second.length ())
-        biggestHit = make_pair (get<1> (*index), get<2> (*index));
-    }
-  return biggestHit;
-  //////////////////////////////////////////////////////////////////////////////
-}
-
-pair<size_t, string>
-ValueLookupTree::findLastOf (const string &s, const vector<string> &targets, const vector<string> &vetoTargets, const size_t pos) const
-{
-  vector<tuple<size_t, size_t, string> > indices;
-  tuple<size_t, size_t, string> firstHit;
-  pair<size_t, string> biggestHit;
-
-  //////////////////////////////////////////////////////////////////////////////
-  // For each of the target strings, find the index of the first instance of
-  // it. Then sort the indices in ascending order.
-  //////////////////////////////////////////////////////////////////////////////
-  for (const auto &target : targets)
-    {
-      size_t index = s.rfind (target, pos);
-      if (!vetoMatch (s, target, index, vetoTargets))
-        indices.emplace_back (index + target.length () - 1, index, target);
-    }
-  sort (indices.begin (), indices.end (), anatools::firstOfTupleDescending);
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // If there are no matches, just return string::npos.
-  //////////////////////////////////////////////////////////////////////////////
-  if (indices.empty ())
-    return make_pair (string::npos, "");
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // If there are multiple targets which match at the same position in the
-  // string, then only return the one which matches the most characters.
-  //////////////////////////////////////////////////////////////////////////////
-  firstHit = indices.at (0);
-  for (auto index = indices.begin (); index != indices.end () && get<0> (*index) == get<0> (firstHit); index++)
-    {
-      if (get<2> (*index).length () > biggestHit.second.length ())
-        biggestHit = make_pair (get<1> (*index), get<2> (*index));
-    }
-  return biggestHit;
-  //////////////////////////////////////////////////////////////////////////////
-}
-
-bool
-ValueLookupTree::vetoMatch (const string &s, const string &target, const size_t index, const vector<string> &vetoTargets) const
+unsigned
+ValueLookupTree::collectionIndex (const string &name)
 {
-  //////////////////////////////////////////////////////////////////////////////
-  // If there was no match, just return true, indicating a veto.
-  //////////////////////////////////////////////////////////////////////////////
-  if (index == string::npos)
-    return true;
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // We veto an operator match if:
-  //   (1) the first character of the operator and the previous character are
-  //   alphanumeric or an underscore.
-  //   (2) the last character of the operator and the next character are
-  //   alphanumeric or an underscore.
-  //   (3) if the match is embedded in one of the veto targets passed to the
-  //   function.
-  //////////////////////////////////////////////////////////////////////////////
-  size_t end = index + target.length () - 1;
-  char first = s.at (index), last = s.at (end),
-       preceding = index > 0 ? s.at (index - 1) : '\0', proceeding = end < s.length () - 1 ? s.at (end + 1) : '\0';
-  if ((isalnum (first) || first == '_') && (isalnum (preceding) || preceding == '_'))
-    return true;
-  if ((isalnum (last) || last == '_') && (isalnum (proceeding) || proceeding == '_'))
-    return true;
-  for (const auto &vetoTarget : vetoTargets)
+  const string &collection = plural (name);
+  for (unsigned j = 0; j < inputCollections_.size (); j++)
     {
-      size_t i = s.find (vetoTarget, max ((size_t) 0, index - vetoTarget.length () - 1));
-      if (i <= index)
-        return true;
+      if (inputCollections_.at (j) == collection)
+        return j;
     }
-  //////////////////////////////////////////////////////////////////////////////
-
-  return false;
+  return inputCollections_.size ();
 }
 
 bool
-ValueLookupTree::isUniqueCase (const ObjMap &objs, const unordered_set<string> &keys) const
+ValueLookupTree::isUniqueCase () const
 {
   //////////////////////////////////////////////////////////////////////////////
   // Returns true only if the given objects are unique and in a specific order.
-  // This is to avoid double counting.
+  // This is to avoid double counting. Objects from the same collection are
+  // next to each other, in order of their collection indices, so it is enough
+  // that their local indices are strictly increasing.
   //////////////////////////////////////////////////////////////////////////////
-  bool pass = true;
-
-  for (const auto &key : keys)
+  for (unsigned j = 1; j < objs_.size (); j++)
     {
-      if (objs.count (key) <= 1)
-        continue;
-      else
-        {
-          auto range = objs.equal_range (key);
-          vector<pair<string, DressedObject> > objsOfThisType (range.first, range.second);
-          sort (objsOfThisType.begin (), objsOfThisType.end (), anatools::collectionIndexAscending);
-          int previousLocalIndex = -1;
-          for (const auto &obj : objsOfThisType)
-            {
-              pass = pass && ((int) obj.second.localIndex > previousLocalIndex);
-              previousLocalIndex = obj.second.localIndex;
-            }
-        }
+      if (firstIndices_.at (j) != j && objs_.at (j).localIndex <= objs_.at (j - 1).localIndex)
+        return false;
     }
 
-  return pass;
-  //////////////////////////////////////////////////////////////////////////////
-}
-
-bool
-ValueLookupTree::insertBinaryInfixOperator (const string &s, Node * const tree, const vector<string> &operators, const vector<string> &vetoOperators) const
-{
-  bool foundAnOperator = false;
-  double x;
-  //////////////////////////////////////////////////////////////////////////////
-  // If the string is a number, then simply return false;
-  //////////////////////////////////////////////////////////////////////////////
-  if (isnumber (s, x))
-    return false;
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // For each operator which is found in the string, split the string into a
-  // left and right substring. These substrings are inserted into the tree and
-  // stored as branches for the operator's node.
-  //////////////////////////////////////////////////////////////////////////////
-  for (auto i = findLastOf (s, operators, vetoOperators); !foundAnOperator && i.first != string::npos; i = i.first ? findLastOf (s, operators, vetoOperators, i.first - 1) : make_pair (string::npos, ""))
-    {
-      string left, right;
-      left = s.substr (0, i.first);
-      right = s.substr (i.first + i.second.length ());
-      if (!splitParentheses (left) && !splitParentheses (right))
-        {
-          anatools::trim (left);
-          anatools::trim (right);
-
-          if (left == "" || right == "") continue;
-          tree->value = i.second;
-          tree->branches.push_back (insert_ (left, tree));
-          tree->branches.push_back (insert_ (right, tree));
-          foundAnOperator = true;
-        }
-    }
-  //////////////////////////////////////////////////////////////////////////////
-
-  return foundAnOperator;
-}
-
-bool
-ValueLookupTree::insertUnaryPrefixOperator (const string &s, Node * const tree, const vector<string> &operators, const vector<string> &vetoOperators) const
-{
-  bool foundAnOperator = false;
-  double x;
-
-  //////////////////////////////////////////////////////////////////////////////
-  // If the string is a number, then simply return false;
-  //////////////////////////////////////////////////////////////////////////////
-  if (isnumber (s, x))
-    return foundAnOperator;
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // For each operator which is found in the string, split the string into a
-  // left and right substring. The right substring is inserted into the tree and
-  // stored as a branch for the operator's node.
-  //////////////////////////////////////////////////////////////////////////////
-  for (auto i = findLastOf (s, operators, vetoOperators); !foundAnOperator && i.first != string::npos; i = i.first ? findLastOf (s, operators, vetoOperators, i.first - 1) : make_pair (string::npos, ""))
-    {
-      string left, right;
-      left = s.substr (0, i.first);
-      right = s.substr (i.first + i.second.length ());
-      if (!splitParentheses (left) && !splitParentheses (right))
-        {
-          anatools::trim (right);
-          tree->value = i.second;
-          tree->branches.push_back (insert_ (right, tree));
-          foundAnOperator = true;
-        }
-    }
-  //////////////////////////////////////////////////////////////////////////////
-
-  return foundAnOperator;
-}
-
-bool
-ValueLookupTree::insertDots (const string &s, Node * const tree) const
-{
-  bool foundAnOperator = false;
-  double x;
-  //////////////////////////////////////////////////////////////////////////////
-  // If the string is a number, then simply return false;
-  //////////////////////////////////////////////////////////////////////////////
-  if (isnumber (s, x))
-    return false;
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // For each operator which is found in the string, split the string into a
-  // left and right substring. These substrings are inserted into the tree and
-  // stored as branches for the operator's node.
-  //////////////////////////////////////////////////////////////////////////////
-  for (auto i = findFirstOf (s, {"."}, {}); !foundAnOperator && i.first != string::npos; i = findFirstOf (s, {"."}, {}, i.first + i.second.length ()))
-    {
-      string left, right;
-      left = s.substr (0, i.first);
-      right = s.substr (i.first + i.second.length ());
-      if (!splitParentheses (left) && !splitParentheses (right))
-        {
-          anatools::trim (left);
-          anatools::trim (right);
-
-          if (left == "" || right == "") continue;
-          tree->value = i.second;
-          tree->branches.push_back (insert_ (left, tree));
-          tree->branches.push_back (insert_ (right, tree));
-          foundAnOperator = true;
-        }
-    }
+  return true;
   //////////////////////////////////////////////////////////////////////////////
-
-  return foundAnOperator;
 }
 
-bool
-ValueLookupTree::insertParentheses (const string &s, Node * const tree) const
+double
+ValueLookupTree::valueLookup (const unsigned collection, const string &variable, const bool iterateObj)
 {
   //////////////////////////////////////////////////////////////////////////////
-  // Look for the first left parenthesis and the last right parenthesis and
-  // simply return false if both are not found.
-  //////////////////////////////////////////////////////////////////////////////
-  size_t leftParenthesis = s.find ('('),
-         rightParenthesis = s.rfind (')');
-  if (leftParenthesis == string::npos || rightParenthesis == string::npos)
-    return false;
-  //////////////////////////////////////////////////////////////////////////////
-
-  //////////////////////////////////////////////////////////////////////////////
-  // Insert the substring between the parentheses into the tree and return
-  // true.
+  // The first lookup in a collection uses its first object. If the collection
+  // appears more than once in the input collections, each later lookup moves
+  // on to its next object, unless iterateObj is false.
   //////////////////////////////////////////////////////////////////////////////
-  string middle = s.substr (leftParenthesis + 1, rightParenthesis - leftParenthesis - 1);
-  anatools::trim (middle);
-  tree->value = "()";
-  tree->branches.push_back (insert_ (middle, tree));
-  return true;
+  if (collection >= objs_.size ())
+    return INVALID_VALUE;
+  unsigned &j = objIterators_.at (collection);
+  if (j >= objs_.size ())
+    j = collection;
+  else if (iterateObj && j + 1 < objs_.size () && firstIndices_.at (j + 1) == collection)
+    j++;
+  void *obj = objs_.at (j).addr;
   //////////////////////////////////////////////////////////////////////////////
-}
-
-double
-ValueLookupTree::valueLookup (const string &collection, const ObjMap &objs, const string &variable, const bool iterateObj)
-{
-  if (!objIterators_.count (collection))
-    {
-      auto range = objs.equal_range (collection);
-      objIterators_[collection] = range.first;
-      shouldIterate_[collection] = (objs.count (collection) > 1);
-    }
-  else if (shouldIterate_.at (collection) && iterateObj)
-    objIterators_.at (collection)++;
-  void *obj = objIterators_.at (collection)->second.addr;
 
   try
     {
-      if (collection == "uservariables")
+      if (inputCollections_.at (collection) == "uservariables")
         return 1; // FIXME
-      if (collection == "eventvariables")
-        return (((EventVariableProducerPayload *) obj)->at (variable));
-      return anatools::getMember (getCollectionType (collection), obj, variable, &functionLookupTable_);
+      // Every reference to an event variable is resolved to its index when
+      // the tree is built, so none is looked up by name here.
+      if (inputCollections_.at (collection) == "eventvariables")
+        return INVALID_VALUE;
+      return anatools::getMember (collectionTypes_.at (collection), obj, variable, &functionLookupTable_);
     }
   catch (...)
     {
       return INVALID_VALUE;
     }
 }
+
+double
+ValueLookupTree::eventvariableLookup (const unsigned index) const
+{
+  const vector<double> &eventvariables = anatools::getMergedEventVariables (*handles_);
+  return (index < eventvariables.size () ? eventvariables.at (index) : INVALID_VALUE);
+}
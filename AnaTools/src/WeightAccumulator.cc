@@ -0,0 +1,49 @@
+#include "OSUT3Analysis/AnaTools/interface/WeightAccumulator.h"
+
+WeightAccumulator::WeightAccumulator (const unsigned n)
+{
+  resize (n);
+}
+
+void
+WeightAccumulator::resize (const unsigned n)
+{
+  buffer_.resize (n, 0.0);
+  sumOfWeights_.resize (n, 0.0);
+  sumOfSquaredWeights_.resize (n, 0.0);
+}
+
+// Adds scale * weights[i] to the i-th sum, and its square to the i-th sum of
+// squares. Only the first min (n, size ()) weights are used. The loop carries
+// no dependencies between elements, so it is vectorized by the compiler.
+void
+WeightAccumulator::add (const double * const weights, const unsigned n, const double scale)
+{
+  const unsigned nWeights = min (n, (unsigned) sumOfWeights_.size ());
+  double * const sum = sumOfWeights_.data ();
+  double * const sum2 = sumOfSquaredWeights_.data ();
+  for (unsigned i = 0; i < nWeights; i++)
+    {
+      const double w = scale * weights[i];
+      sum[i] += w;
+      sum2[i] += w * w;
+    }
+}
+
+// Writes the accumulated sums into consecutive bins of the histogram starting
+// at firstBin, with the bin errors taken from the sums of squares. Entries
+// which do not fit in the histogram are dropped.
+void
+WeightAccumulator::fill (TH1D * const histogram, const int firstBin) const
+{
+  if (!histogram)
+    return;
+  for (unsigned i = 0; i < sumOfWeights_.size (); i++)
+    {
+      const int bin = firstBin + i;
+      if (bin > histogram->GetNbinsX ())
+        break;
+      histogram->SetBinContent (bin, histogram->GetBinContent (bin) + sumOfWeights_.at (i));
+      histogram->SetBinError (bin, hypot (histogram->GetBinError (bin), sqrt (sumOfSquaredWeights_.at (i))));
+    }
+}
@@ -15,6 +15,12 @@ namespace {
      edm::Wrapper<CutCalculatorPayload> CutCalculatorPayloadDummy2;
      edm::Wrapper<vector<CutCalculatorPayload> > CutCalculatorPayloadDummy3;
 
+     CutSchema CutSchemaDummy0;
+     edm::Wrapper<CutSchema> CutSchemaDummy1;
+
+     FlagBits FlagBitsDummy0;
+     PackedFlagMap PackedFlagMapDummy0;
+
      Cut cutdummy0;
      edm::Wrapper<Cut> cutdummy1;
      vector<Cut> cutdummy2;
@@ -174,20 +174,20 @@ namespace osu
         const float energyOfProton ()   const { return energyGivenMass(0.938272046); };
 
         // number of hits differentiated by location in detector
-        const unsigned char numberOfTrackerHits ()     const { return this->hitPattern().trackerLayersWithMeasurement(); };
-        const unsigned char numberOfPixelHits ()       const { return this->hitPattern().pixelLayersWithMeasurement(); };
-        const unsigned char numberOfStripHits ()       const { return this->hitPattern().stripLayersWithMeasurement(); };
-        const unsigned char numberOfPixelBarrelHits () const { return this->hitPattern().pixelBarrelLayersWithMeasurement(); };
-        const unsigned char numberOfPixelEndcapHits () const { return this->hitPattern().pixelEndcapLayersWithMeasurement(); };
-        const unsigned char numberOfStripTIBHits ()    const { return this->hitPattern().stripTIBLayersWithMeasurement(); };
-        const unsigned char numberOfStripTIDHits ()    const { return this->hitPattern().stripTIDLayersWithMeasurement(); };
-        const unsigned char numberOfStripTOBHits ()    const { return this->hitPattern().stripTOBLayersWithMeasurement(); };
-        const unsigned char numberOfStripTECHits ()    const { return this->hitPattern().stripTECLayersWithMeasurement(); };
+        const unsigned char numberOfTrackerHits ()     const { return this->hitPatternSummary ().layersWithMeasurement[TRACKER]; };
+        const unsigned char numberOfPixelHits ()       const { return this->hitPatternSummary ().layersWithMeasurement[PIXEL]; };
+        const unsigned char numberOfStripHits ()       const { return this->hitPatternSummary ().layersWithMeasurement[STRIP]; };
+        const unsigned char numberOfPixelBarrelHits () const { return this->hitPatternSummary ().layersWithMeasurement[PIXEL_BARREL]; };
+        const unsigned char numberOfPixelEndcapHits () const { return this->hitPatternSummary ().layersWithMeasurement[PIXEL_ENDCAP]; };
+        const unsigned char numberOfStripTIBHits ()    const { return this->hitPatternSummary ().layersWithMeasurement[STRIP_TIB]; };
+        const unsigned char numberOfStripTIDHits ()    const { return this->hitPatternSummary ().layersWithMeasurement[STRIP_TID]; };
+        const unsigned char numberOfStripTOBHits ()    const { return this->hitPatternSummary ().layersWithMeasurement[STRIP_TOB]; };
+        const unsigned char numberOfStripTECHits ()    const { return this->hitPatternSummary ().layersWithMeasurement[STRIP_TEC]; };
 
         // missing hits differentiated by location on track
-        const unsigned char missingInnerHits ()  const { return this->hitPattern().trackerLayersWithoutMeasurement(reco::HitPattern::MISSING_INNER_HITS); };
-        const unsigned char missingMiddleHits () const { return this->hitPattern().trackerLayersWithoutMeasurement(reco::HitPattern::TRACK_HITS); };
-        const unsigned char missingOuterHits ()  const { return this->hitPattern().trackerLayersWithoutMeasurement(reco::HitPattern::MISSING_OUTER_HITS); };
+        const unsigned char missingInnerHits ()  const { return this->hitPatternSummary ().layersWithoutMeasurement[reco::HitPattern::MISSING_INNER_HITS][TRACKER]; };
+        const unsigned char missingMiddleHits () const { return this->hitPatternSummary ().layersWithoutMeasurement[reco::HitPattern::TRACK_HITS][TRACKER]; };
+        const unsigned char missingOuterHits ()  const { return this->hitPatternSummary ().layersWithoutMeasurement[reco::HitPattern::MISSING_OUTER_HITS][TRACKER]; };
 
         // missing hits differentiated by location in detector
         const unsigned char missingTrackerHits () const;
@@ -211,7 +211,61 @@ namespace osu
         const unsigned char expectedStripTOBHits () const;
         const unsigned char expectedStripTECHits () const;
 
+        // Regions of the tracker for which the numbers of layers with and
+        // without measurement are kept in the hit pattern summary.
+        enum HitPatternRegion
+        {
+          TRACKER,
+          PIXEL,
+          STRIP,
+          PIXEL_BARREL,
+          PIXEL_ENDCAP,
+          STRIP_TIB,
+          STRIP_TID,
+          STRIP_TOB,
+          STRIP_TEC,
+          N_HIT_PATTERN_REGIONS
+        };
+
+        // Everything the accessors above need from the hit pattern, decoded in
+        // one pass when the track is constructed or read from a file and
+        // stored with it, so that the track is never modified once it is put
+        // into the event. The layers without measurement are indexed by
+        // reco::HitPattern::HitCategory.
+        struct HitPatternSummary
+        {
+          bool filled = false;
+
+          int numberOfValidHits;
+          int numberOfValidPixelHits;
+          int numberOfValidPixelBarrelHits;
+          int numberOfValidPixelEndcapHits;
+
+          unsigned char layersWithMeasurement[N_HIT_PATTERN_REGIONS];
+          unsigned char layersWithoutMeasurement[3][N_HIT_PATTERN_REGIONS];
+
+          uint16_t validPixelBarrelLayers; // bit n is set for a valid hit in layer n
+          uint16_t validPixelEndcapLayers;
+
+          uint16_t packedPixelBarrelHitPattern;
+          uint16_t packedPixelEndcapHitPattern;
+
+          uint16_t firstLayerWithValidHit;
+          uint16_t lastLayerWithValidHit;
+        };
+
+        // Decodes the hit pattern into the given summary. It is called by
+        // every constructor except the default one, and by the read rule in
+        // classes_def.xml for tracks read from a file.
+        void decodeHitPattern (HitPatternSummary &) const;
+
     private:
+        HitPatternSummary hitPatternSummary_;
+
+        const HitPatternSummary &hitPatternSummary () const;
+        const unsigned char missingHits (const HitPatternRegion) const;
+        const unsigned char expectedHits (const HitPatternRegion) const;
+
         double dRMinJet_;
         double minDeltaRForFiducialTrack_;
 
@@ -258,8 +312,8 @@ namespace osu
 #endif
         const bool isBadGsfTrack (const reco::GsfTrack &) const;
         int isCloseToBadEcalChannel (const double &);
-        template<class T> const int extraMissingMiddleHits (const T &) const;
-        template<class T> const int extraMissingOuterHits (const T &) const;
+        const int extraMissingMiddleHits (const int, const int) const;
+        const int extraMissingOuterHits (const int, const int) const;
 
         const double energyGivenMass (const double) const;
     };
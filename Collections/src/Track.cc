@@ -21,6 +21,9 @@ osu::Track::Track () :
   deltaRToClosestPFMuon_     (INVALID_VALUE),
   deltaRToClosestPFChHad_    (INVALID_VALUE)
 {
+  // ROOT default-constructs each track before reading it, so the summary is
+  // left unfilled here and is instead decoded by the read rule in
+  // classes_def.xml, once the hit pattern has been read.
 }
 
 osu::Track::Track (const TYPE(tracks) &track) :
@@ -43,6 +46,7 @@ osu::Track::Track (const TYPE(tracks) &track) :
   deltaRToClosestPFMuon_     (INVALID_VALUE),
   deltaRToClosestPFChHad_    (INVALID_VALUE)
 {
+  decodeHitPattern (this->hitPatternSummary_);
 }
 
 osu::Track::Track (const TYPE(tracks) &track, const edm::Handle<vector<osu::Mcparticle> > &particles) :
@@ -65,6 +69,7 @@ osu::Track::Track (const TYPE(tracks) &track, const edm::Handle<vector<osu::Mcpa
   deltaRToClosestPFMuon_     (INVALID_VALUE),
   deltaRToClosestPFChHad_    (INVALID_VALUE)
 {
+  decodeHitPattern (this->hitPatternSummary_);
 }
 
 osu::Track::Track (const TYPE(tracks) &track, const edm::Handle<vector<osu::Mcparticle> > &particles, const edm::ParameterSet &cfg) :
@@ -87,6 +92,7 @@ osu::Track::Track (const TYPE(tracks) &track, const edm::Handle<vector<osu::Mcpa
   deltaRToClosestPFMuon_     (INVALID_VALUE),
   deltaRToClosestPFChHad_    (INVALID_VALUE)
 {
+  decodeHitPattern (this->hitPatternSummary_);
 }
 
 osu::Track::Track (const TYPE(tracks) &track, 
@@ -116,6 +122,7 @@ osu::Track::Track (const TYPE(tracks) &track,
 
   // PrintTrackHitPatternInfo();
 
+  decodeHitPattern (this->hitPatternSummary_);
 }
 
 osu::Track::Track (const TYPE(tracks) &track, 
@@ -214,6 +221,7 @@ osu::Track::Track (const TYPE(tracks) &track,
 
   // PrintTrackHitPatternInfo();
 
+  decodeHitPattern (this->hitPatternSummary_);
 }
 
 #ifdef DISAPP_TRKS
@@ -369,7 +377,7 @@ osu::Track::bestTrackNumberOfValidHits () const
 {
   int nHits = gsfTrackNumberOfValidHits ();
   if (IS_INVALID(nHits) || isBadGsfTrack (*this->matchedGsfTrack_))
-    nHits = this->hitPattern ().numberOfValidHits ();
+    nHits = this->hitPatternSummary ().numberOfValidHits;
 
   return nHits;
 }
@@ -379,7 +387,7 @@ osu::Track::bestTrackNumberOfValidPixelHits () const
 {
   int nHits = gsfTrackNumberOfValidPixelHits ();
   if (IS_INVALID(nHits) || isBadGsfTrack (*this->matchedGsfTrack_))
-    nHits = this->hitPattern ().numberOfValidPixelHits ();
+    nHits = this->hitPatternSummary ().numberOfValidPixelHits;
 
   return nHits;
 }
@@ -389,7 +397,7 @@ osu::Track::bestTrackNumberOfValidPixelBarrelHits () const
 {
   int nHits = gsfTrackNumberOfValidPixelBarrelHits ();
   if (IS_INVALID(nHits) || isBadGsfTrack (*this->matchedGsfTrack_))
-    nHits = this->hitPattern ().numberOfValidPixelBarrelHits ();
+    nHits = this->hitPatternSummary ().numberOfValidPixelBarrelHits;
 
   return nHits;
 }
@@ -399,7 +407,7 @@ osu::Track::bestTrackNumberOfValidPixelEndcapHits () const
 {
   int nHits = gsfTrackNumberOfValidPixelEndcapHits ();
   if (IS_INVALID(nHits) || isBadGsfTrack (*this->matchedGsfTrack_))
-    nHits = this->hitPattern ().numberOfValidPixelEndcapHits ();
+    nHits = this->hitPatternSummary ().numberOfValidPixelEndcapHits;
 
   return nHits;
 }
@@ -409,7 +417,7 @@ osu::Track::bestTrackMissingInnerHits () const
 {
   int nHits = gsfTrackMissingInnerHits ();
   if (IS_INVALID(nHits) || isBadGsfTrack (*this->matchedGsfTrack_))
-    nHits = this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS);
+    nHits = this->missingInnerHits ();
 
   return nHits;
 }
@@ -419,7 +427,7 @@ osu::Track::bestTrackMissingMiddleHits () const
 {
   int nHits = gsfTrackMissingMiddleHits ();
   if (IS_INVALID(nHits) || isBadGsfTrack (*this->matchedGsfTrack_))
-    nHits = this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS);
+    nHits = this->missingMiddleHits ();
 
   return nHits;
 }
@@ -429,7 +437,7 @@ osu::Track::bestTrackMissingOuterHits () const
 {
   int nHits = gsfTrackMissingOuterHits ();
   if (IS_INVALID(nHits) || isBadGsfTrack (*this->matchedGsfTrack_))
-    nHits = this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS);
+    nHits = this->missingOuterHits ();
 
   return nHits;
 }
@@ -440,12 +448,12 @@ osu::Track::bestTrackMissingOuterHits () const
 
 /* Missing middle hits */
 
-template<class T> const int
-osu::Track::extraMissingMiddleHits (const T &track) const
+const int
+osu::Track::extraMissingMiddleHits (const int nStripLayers, const int nTOBLayers) const
 {
   int nHits = 0;
   bool countMissingMiddleHits = false;
-  for (int i = 0; i < track.hitPattern ().stripLayersWithMeasurement () - (dropTOBDecision_ ? this->hitPattern ().stripTOBLayersWithMeasurement () : 0); i++)
+  for (int i = 0; i < nStripLayers - (dropTOBDecision_ ? nTOBLayers : 0); i++)
     {
       bool hit = !dropMiddleHitDecisions_.at (i);
       if (!hit && countMissingMiddleHits)
@@ -460,8 +468,9 @@ osu::Track::extraMissingMiddleHits (const T &track) const
 const int
 osu::Track::hitDrop_missingMiddleHits () const
 {
-  int nDropHits = extraMissingMiddleHits (*this);
-  return this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS) + nDropHits;
+  const HitPatternSummary &summary = this->hitPatternSummary ();
+  int nDropHits = extraMissingMiddleHits (summary.layersWithMeasurement[STRIP], summary.layersWithMeasurement[STRIP_TOB]);
+  return this->missingMiddleHits () + nDropHits;
 }
 
 const int
@@ -469,7 +478,7 @@ osu::Track::hitDrop_gsfTrackMissingMiddleHits () const
 {
   if (this->matchedGsfTrack_.isNonnull ())
     {
-      int nDropHits = extraMissingMiddleHits (*this->matchedGsfTrack_);
+      int nDropHits = extraMissingMiddleHits (this->matchedGsfTrack_->hitPattern ().stripLayersWithMeasurement (), this->numberOfStripTOBHits ());
       return this->matchedGsfTrack_->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS) + nDropHits;
     }
 
@@ -488,11 +497,11 @@ osu::Track::hitDrop_bestTrackMissingMiddleHits () const
 
 /* Missing outer hits */
 
-template<class T> const int
-osu::Track::extraMissingOuterHits (const T &track) const
+const int
+osu::Track::extraMissingOuterHits (const int nStripLayers, const int nTOBLayers) const
 {
   int nHits = 0;
-  for (int i = 0; i < track.hitPattern ().stripLayersWithMeasurement () - (dropTOBDecision_ ? this->hitPattern ().stripTOBLayersWithMeasurement () : 0); i++)
+  for (int i = 0; i < nStripLayers - (dropTOBDecision_ ? nTOBLayers : 0); i++)
     {
       bool hit = !dropHitDecisions_.at (i);
       if (!hit)
@@ -507,9 +516,10 @@ osu::Track::extraMissingOuterHits (const T &track) const
 const int
 osu::Track::hitAndTOBDrop_missingOuterHits () const
 {
-  int nDropTOBHits = (dropTOBDecision_ ? this->hitPattern ().stripTOBLayersWithMeasurement () : 0);
-  int nDropHits = extraMissingOuterHits (*this);
-  return this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS) + nDropTOBHits + nDropHits;
+  const HitPatternSummary &summary = this->hitPatternSummary ();
+  int nDropTOBHits = (dropTOBDecision_ ? summary.layersWithMeasurement[STRIP_TOB] : 0);
+  int nDropHits = extraMissingOuterHits (summary.layersWithMeasurement[STRIP], summary.layersWithMeasurement[STRIP_TOB]);
+  return this->missingOuterHits () + nDropTOBHits + nDropHits;
 }
 
 const int
@@ -518,7 +528,7 @@ osu::Track::hitAndTOBDrop_gsfTrackMissingOuterHits () const
   if (this->matchedGsfTrack_.isNonnull ())
     {
       int nDropTOBHits = (dropTOBDecision_ ? this->matchedGsfTrack_->hitPattern ().stripTOBLayersWithMeasurement () : 0);
-      int nDropHits = extraMissingOuterHits (*this->matchedGsfTrack_);
+      int nDropHits = extraMissingOuterHits (this->matchedGsfTrack_->hitPattern ().stripLayersWithMeasurement (), this->numberOfStripTOBHits ());
       return this->matchedGsfTrack_->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS) + nDropTOBHits + nDropHits;
     }
 
@@ -661,47 +671,13 @@ osu::Track::PrintTrackHitPatternInfo () const
 const bool
 osu::Track::hasValidHitInPixelBarrelLayer (const uint16_t layer) const
 {
-
-  const reco::HitPattern &p = this->hitPattern();
-
-  // Loop over TRACK_HITS
-#if CMSSW_VERSION_CODE >= CMSSW_VERSION(9,4,0)
-  for (int i = 0; i < p.numberOfAllHits(reco::HitPattern::TRACK_HITS); i++) {
-#else
-  for (int i = 0; i < p.numberOfHits(reco::HitPattern::TRACK_HITS); i++) {
-#endif
-    uint16_t hit = p.getHitPattern(reco::HitPattern::TRACK_HITS, i);
-    if(reco::HitPattern::pixelBarrelHitFilter(hit) &&
-       reco::HitPattern::getLayer(hit) == layer &&
-       reco::HitPattern::validHitFilter(hit)) {
-         return true;
-     }
-   }
-
-   return false;
- }
+  return (layer < 16 && (this->hitPatternSummary ().validPixelBarrelLayers >> layer) & 0x1);
+}
 
 const bool
 osu::Track::hasValidHitInPixelEndcapLayer (const uint16_t layer) const
 {
-
-  const reco::HitPattern &p = this->hitPattern();
-
-  // Loop over TRACK_HITS
-#if CMSSW_VERSION_CODE >= CMSSW_VERSION(9,4,0)
-  for (int i = 0; i < p.numberOfAllHits(reco::HitPattern::TRACK_HITS); i++) {
-#else
-  for (int i = 0; i < p.numberOfHits(reco::HitPattern::TRACK_HITS); i++) {
-#endif
-    uint16_t hit = p.getHitPattern(reco::HitPattern::TRACK_HITS, i);
-    if(reco::HitPattern::pixelEndcapHitFilter(hit) &&
-       reco::HitPattern::getLayer(hit) == layer &&
-       reco::HitPattern::validHitFilter(hit)) {
-         return true;
-     }
-   }
-
-   return false;
+  return (layer < 16 && (this->hitPatternSummary ().validPixelEndcapLayers >> layer) & 0x1);
 }
 
 const uint16_t
@@ -725,67 +701,7 @@ osu::Track::packedPixelBarrelHitPattern () const
 
   // This looks at TRACK_HITS, MISSING_INNER_HITS, and MISSING_OUTER_HITS
 
-  uint8_t statusPXB1 = 0x4;
-  uint8_t statusPXB2 = 0x4;
-  uint8_t statusPXB3 = 0x4;
-
-  const reco::HitPattern &p = this->hitPattern();
-
-  const std::array<reco::HitPattern::HitCategory, 3> categories = {{reco::HitPattern::TRACK_HITS, reco::HitPattern::MISSING_INNER_HITS, reco::HitPattern::MISSING_OUTER_HITS}};
-
-  // Loop over TRACK_HITS, MISSING_INNER_HITS, and MISSING_OUTER_HITS
-  for (auto category : categories) {
-
-#if CMSSW_VERSION_CODE >= CMSSW_VERSION(9,4,0)
-    for (int i = 0; i < p.numberOfAllHits(category); i++) {
-#else
-    for (int i = 0; i < p.numberOfHits(category); i++) {
-#endif
-      uint16_t hit = p.getHitPattern(category, i);
-
-      if(reco::HitPattern::pixelBarrelHitFilter(hit)) {
-
-        uint32_t layer = reco::HitPattern::getLayer(hit);
-
-        if(layer == 1) {
-          if(statusPXB1 != 0x4) { // if you already found a hit, mark this as having multiple hits
-            statusPXB1 = 0x5;
-            continue;
-          }
-          else statusPXB1 = reco::HitPattern::getHitType(hit);
-        }
-
-        if(layer == 2) {
-          if(statusPXB2 != 0x4) { // if you already found a hit, mark this as having multiple hits
-            statusPXB2 = 0x5;
-            continue;
-          }
-          else statusPXB2 = reco::HitPattern::getHitType(hit);
-        }
-
-        if(layer == 3) {
-          if(statusPXB3 != 0x4) { // if you already found a hit, mark this as having multiple hits
-            statusPXB3 = 0x5;
-            continue;
-          }
-          else statusPXB3 = reco::HitPattern::getHitType(hit);
-        }
-
-      } // if pixel barrel hit
-
-    } // loop over hits in category
-
-  } // loop over categories
-
-  // Now pack these into a single return value
-
-  uint16_t result = 0;
-
-  result |= (statusPXB1 << 0);
-  result |= (statusPXB2 << 3);
-  result |= (statusPXB3 << 6);
-
-  return result;
+  return this->hitPatternSummary ().packedPixelBarrelHitPattern;
 
 }
 
@@ -800,137 +716,144 @@ osu::Track::packedPixelEndcapHitPattern () const
   // | status | status |
   // |  PXF2  |  PXF1  |
   // +--------+--------+
-  // where status:
-  // 0 = valid
-  // 1 = missing
-  // 2 = inactive
-  // 3 = bad
-  // 4 = no hit present in HitPattern at all
-  // 5 = found multiple hits somehow
-
-  // This looks at TRACK_HITS, MISSING_INNER_HITS, and MISSING_OUTER_HITS
+  // where status is the same as for packedPixelBarrelHitPattern
 
-  uint8_t statusPXF1 = 0x4;
-  uint8_t statusPXF2 = 0x4;
-
-  const reco::HitPattern &p = this->hitPattern();
-
-  const std::array<reco::HitPattern::HitCategory, 3> categories = {{reco::HitPattern::TRACK_HITS, reco::HitPattern::MISSING_INNER_HITS, reco::HitPattern::MISSING_OUTER_HITS}};
-
-  // Loop over TRACK_HITS, MISSING_INNER_HITS, and MISSING_OUTER_HITS
-  for (auto category : categories) {
-
-#if CMSSW_VERSION_CODE >= CMSSW_VERSION(9,4,0)
-    for (int i = 0; i < p.numberOfAllHits(category); i++) {
-#else
-    for (int i = 0; i < p.numberOfHits(category); i++) {
-#endif
-      uint16_t hit = p.getHitPattern(category, i);
-
-      if(reco::HitPattern::pixelEndcapHitFilter(hit)) {
-
-        uint32_t layer = reco::HitPattern::getLayer(hit);
-
-        if(layer == 1) {
-          if(statusPXF1 != 0x4) { // if you already found a hit, mark this as having multiple hits
-            statusPXF1 = 0x5;
-            continue;
-          }
-          else statusPXF1 = reco::HitPattern::getHitType(hit);
-        }
-
-        if(layer == 2) {
-          if(statusPXF2 != 0x4) { // if you already found a hit, mark this as having multiple hits
-            statusPXF2 = 0x5;
-            continue;
-          }
-          else statusPXF2 = reco::HitPattern::getHitType(hit);
-        }
-
-      } // if pixel endcap hit
-
-    } // loop over hits in category
-
-  } // loop over categories
-
-  // Now pack these into a single return value
-
-  uint16_t result = 0;
-
-  result |= (statusPXF1 << 0);
-  result |= (statusPXF2 << 3);
-
-  return result;
+  return this->hitPatternSummary ().packedPixelEndcapHitPattern;
 
 }
 
 const uint16_t
 osu::Track::firstLayerWithValidHit () const
 {
+  return this->hitPatternSummary ().firstLayerWithValidHit;
+}
 
-  bool foundAValidHit = false;
-  uint16_t earliestValidHit = 0;
-
-  const reco::HitPattern &p = this->hitPattern();
-
-  // loop over the TRACK_HITS of the track
-#if CMSSW_VERSION_CODE >= CMSSW_VERSION(9,4,0)
-  for (int i = 0; i < p.numberOfAllHits(reco::HitPattern::TRACK_HITS); i++) {
-#else
-  for (int i = 0; i < p.numberOfHits(reco::HitPattern::TRACK_HITS); i++) {
-#endif
+const uint16_t
+osu::Track::lastLayerWithValidHit () const
+{
+  return this->hitPatternSummary ().lastLayerWithValidHit;
+}
 
-    uint16_t pattern = p.getHitPattern(reco::HitPattern::TRACK_HITS, i);
-    uint16_t hitType = (pattern >> 0) & 0x3; // results in just the hit type bits
+const osu::Track::HitPatternSummary &
+osu::Track::hitPatternSummary () const
+{
+  if (this->hitPatternSummary_.filled)
+    return this->hitPatternSummary_;
 
-    pattern = (pattern - (1 << 10)) >> 3; // results in just the structure/subStructure/subSubStructure bits
+  // Only a default-constructed track which was not read from a file has no
+  // summary. It is decoded for each call into a copy for this thread, without
+  // modifying the track.
+  static thread_local HitPatternSummary summary;
+  decodeHitPattern (summary);
+  return summary;
+}
 
-    if(hitType == reco::HitPattern::HIT_TYPE::VALID) {
-      if(!foundAValidHit) {
-        foundAValidHit = true;
-        earliestValidHit = pattern;
-      }
-      else if(pattern < earliestValidHit) earliestValidHit = pattern;
-    }
+void
+osu::Track::decodeHitPattern (HitPatternSummary &summary) const
+{
+  const reco::HitPattern &p = this->hitPattern();
 
-  }
+  summary.numberOfValidHits = p.numberOfValidHits ();
+  summary.numberOfValidPixelHits = p.numberOfValidPixelHits ();
+  summary.numberOfValidPixelBarrelHits = p.numberOfValidPixelBarrelHits ();
+  summary.numberOfValidPixelEndcapHits = p.numberOfValidPixelEndcapHits ();
+
+  summary.layersWithMeasurement[TRACKER]      = p.trackerLayersWithMeasurement ();
+  summary.layersWithMeasurement[PIXEL]        = p.pixelLayersWithMeasurement ();
+  summary.layersWithMeasurement[STRIP]        = p.stripLayersWithMeasurement ();
+  summary.layersWithMeasurement[PIXEL_BARREL] = p.pixelBarrelLayersWithMeasurement ();
+  summary.layersWithMeasurement[PIXEL_ENDCAP] = p.pixelEndcapLayersWithMeasurement ();
+  summary.layersWithMeasurement[STRIP_TIB]    = p.stripTIBLayersWithMeasurement ();
+  summary.layersWithMeasurement[STRIP_TID]    = p.stripTIDLayersWithMeasurement ();
+  summary.layersWithMeasurement[STRIP_TOB]    = p.stripTOBLayersWithMeasurement ();
+  summary.layersWithMeasurement[STRIP_TEC]    = p.stripTECLayersWithMeasurement ();
 
-  return earliestValidHit;
+  const std::array<reco::HitPattern::HitCategory, 3> categories = {{reco::HitPattern::TRACK_HITS, reco::HitPattern::MISSING_INNER_HITS, reco::HitPattern::MISSING_OUTER_HITS}};
 
-}
+  for (auto category : categories)
+    {
+      unsigned char * const layers = summary.layersWithoutMeasurement[category];
+      layers[TRACKER]      = p.trackerLayersWithoutMeasurement (category);
+      layers[PIXEL]        = p.pixelLayersWithoutMeasurement (category);
+      layers[STRIP]        = p.stripLayersWithoutMeasurement (category);
+      layers[PIXEL_BARREL] = p.pixelBarrelLayersWithoutMeasurement (category);
+      layers[PIXEL_ENDCAP] = p.pixelEndcapLayersWithoutMeasurement (category);
+      layers[STRIP_TIB]    = p.stripTIBLayersWithoutMeasurement (category);
+      layers[STRIP_TID]    = p.stripTIDLayersWithoutMeasurement (category);
+      layers[STRIP_TOB]    = p.stripTOBLayersWithoutMeasurement (category);
+      layers[STRIP_TEC]    = p.stripTECLayersWithoutMeasurement (category);
+    }
 
-const uint16_t
-osu::Track::lastLayerWithValidHit () const
-{
+  // The status of each of PXB1-3 and PXF1-2, as in packedPixelBarrelHitPattern
+  // and packedPixelEndcapHitPattern, indexed by layer.
+  uint8_t statusPXB[4] = {0x4, 0x4, 0x4, 0x4};
+  uint8_t statusPXF[3] = {0x4, 0x4, 0x4};
 
   bool foundAValidHit = false;
-  uint16_t latestValidHit = 0;
-
-  const reco::HitPattern &p = this->hitPattern();
+  summary.validPixelBarrelLayers = summary.validPixelEndcapLayers = 0;
+  summary.firstLayerWithValidHit = summary.lastLayerWithValidHit = 0;
 
-  // loop over the TRACK_HITS of the track
+  // Loop over TRACK_HITS, MISSING_INNER_HITS, and MISSING_OUTER_HITS
+  for (auto category : categories)
+    {
 #if CMSSW_VERSION_CODE >= CMSSW_VERSION(9,4,0)
-  for (int i = 0; i < p.numberOfAllHits(reco::HitPattern::TRACK_HITS); i++) {
+      for (int i = 0; i < p.numberOfAllHits(category); i++)
 #else
-  for (int i = 0; i < p.numberOfHits(reco::HitPattern::TRACK_HITS); i++) {
+      for (int i = 0; i < p.numberOfHits(category); i++)
 #endif
-    uint16_t pattern = p.getHitPattern(reco::HitPattern::TRACK_HITS, i);
-    uint16_t hitType = (pattern >> 0) & 0x3; // results in just the hit type bits
-
-    pattern = (pattern - (1 << 10)) >> 3; // results in just the structure/subStructure/subSubStructure bits
+        {
+          uint16_t hit = p.getHitPattern(category, i);
+          uint32_t layer = reco::HitPattern::getLayer(hit);
+          bool isPixelBarrelHit = reco::HitPattern::pixelBarrelHitFilter(hit),
+               isPixelEndcapHit = reco::HitPattern::pixelEndcapHitFilter(hit);
+
+          // if a hit was already found in this layer, mark it as having multiple hits
+          if(isPixelBarrelHit && layer >= 1 && layer <= 3)
+            statusPXB[layer] = (statusPXB[layer] != 0x4) ? 0x5 : reco::HitPattern::getHitType(hit);
+          if(isPixelEndcapHit && layer >= 1 && layer <= 2)
+            statusPXF[layer] = (statusPXF[layer] != 0x4) ? 0x5 : reco::HitPattern::getHitType(hit);
+
+          if(category != reco::HitPattern::TRACK_HITS || !reco::HitPattern::validHitFilter(hit))
+            continue;
 
-    if(hitType == reco::HitPattern::HIT_TYPE::VALID) {
-      if(!foundAValidHit) {
-        foundAValidHit = true;
-        latestValidHit = pattern;
-      }
-      else if(pattern > latestValidHit) latestValidHit = pattern;
+          if(isPixelBarrelHit)
+            summary.validPixelBarrelLayers |= (1 << layer);
+          if(isPixelEndcapHit)
+            summary.validPixelEndcapLayers |= (1 << layer);
+
+          uint16_t pattern = (hit - (1 << 10)) >> 3; // results in just the structure/subStructure/subSubStructure bits
+          if(!foundAValidHit)
+            {
+              foundAValidHit = true;
+              summary.firstLayerWithValidHit = summary.lastLayerWithValidHit = pattern;
+            }
+          else
+            {
+              summary.firstLayerWithValidHit = min (summary.firstLayerWithValidHit, pattern);
+              summary.lastLayerWithValidHit = max (summary.lastLayerWithValidHit, pattern);
+            }
+        }
     }
 
-  }
+  summary.packedPixelBarrelHitPattern = (statusPXB[1] << 0) | (statusPXB[2] << 3) | (statusPXB[3] << 6);
+  summary.packedPixelEndcapHitPattern = (statusPXF[1] << 0) | (statusPXF[2] << 3);
 
-  return latestValidHit;
+  summary.filled = true;
+}
 
+const unsigned char
+osu::Track::missingHits (const HitPatternRegion region) const
+{
+  const HitPatternSummary &summary = this->hitPatternSummary ();
+  return (summary.layersWithoutMeasurement[reco::HitPattern::MISSING_INNER_HITS][region]
+        + summary.layersWithoutMeasurement[reco::HitPattern::TRACK_HITS][region]
+        + summary.layersWithoutMeasurement[reco::HitPattern::MISSING_OUTER_HITS][region]);
+}
+
+const unsigned char
+osu::Track::expectedHits (const HitPatternRegion region) const
+{
+  return this->hitPatternSummary ().layersWithMeasurement[region] + this->missingHits (region);
 }
 
 /******************************************************************************/
@@ -1028,154 +951,109 @@ osu::Track::energyGivenMass (const double mass) const
 const unsigned char
 osu::Track::missingTrackerHits () const
 {
-  return (this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (TRACKER);
 }
 
 const unsigned char
 osu::Track::missingPixelHits () const
 {
-  return (this->hitPattern ().pixelLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().pixelLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().pixelLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (PIXEL);
 }
 
 const unsigned char
 osu::Track::missingStripHits () const
 {
-  return (this->hitPattern ().stripLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (STRIP);
 }
 
 const unsigned char
 osu::Track::missingPixelBarrelHits () const
 {
-  return (this->hitPattern ().pixelBarrelLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().pixelBarrelLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().pixelBarrelLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (PIXEL_BARREL);
 }
 
 const unsigned char
 osu::Track::missingPixelEndcapHits () const
 {
-  return (this->hitPattern ().pixelEndcapLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().pixelEndcapLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().pixelEndcapLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (PIXEL_ENDCAP);
 }
 
 const unsigned char
 osu::Track::missingStripTIBHits () const
 {
-  return (this->hitPattern ().stripTIBLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTIBLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTIBLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (STRIP_TIB);
 }
 
 const unsigned char
 osu::Track::missingStripTIDHits () const
 {
-  return (this->hitPattern ().stripTIDLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTIDLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTIDLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (STRIP_TID);
 }
 
 const unsigned char
 osu::Track::missingStripTOBHits () const
 {
-  return (this->hitPattern ().stripTOBLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTOBLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTOBLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (STRIP_TOB);
 }
 
 const unsigned char
 osu::Track::missingStripTECHits () const
 {
-  return (this->hitPattern ().stripTECLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTECLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTECLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->missingHits (STRIP_TEC);
 }
 
 const unsigned char
 osu::Track::expectedTrackerHits () const
 {
-  return (this->hitPattern ().trackerLayersWithMeasurement ()
-        + this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().trackerLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (TRACKER);
 }
 
 const unsigned char
 osu::Track::expectedPixelHits () const
 {
-  return (this->hitPattern ().pixelLayersWithMeasurement ()
-        + this->hitPattern ().pixelLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().pixelLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().pixelLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (PIXEL);
 }
 
 const unsigned char
 osu::Track::expectedStripHits () const
 {
-  return (this->hitPattern ().stripLayersWithMeasurement ()
-        + this->hitPattern ().stripLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (STRIP);
 }
 
 const unsigned char
 osu::Track::expectedPixelBarrelHits () const
 {
-  return (this->hitPattern ().pixelBarrelLayersWithMeasurement ()
-        + this->hitPattern ().pixelBarrelLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().pixelBarrelLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().pixelBarrelLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (PIXEL_BARREL);
 }
 
 const unsigned char
 osu::Track::expectedPixelEndcapHits () const
 {
-  return (this->hitPattern ().pixelEndcapLayersWithMeasurement ()
-        + this->hitPattern ().pixelEndcapLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().pixelEndcapLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().pixelEndcapLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (PIXEL_ENDCAP);
 }
 
 const unsigned char
 osu::Track::expectedStripTIBHits () const
 {
-  return (this->hitPattern ().stripTIBLayersWithMeasurement ()
-        + this->hitPattern ().stripTIBLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTIBLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTIBLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (STRIP_TIB);
 }
 
 const unsigned char
 osu::Track::expectedStripTIDHits () const
 {
-  return (this->hitPattern ().stripTIDLayersWithMeasurement ()
-        + this->hitPattern ().stripTIDLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTIDLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTIDLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (STRIP_TID);
 }
 
 const unsigned char
 osu::Track::expectedStripTOBHits () const
 {
-  return (this->hitPattern ().stripTOBLayersWithMeasurement ()
-        + this->hitPattern ().stripTOBLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTOBLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTOBLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (STRIP_TOB);
 }
 
 const unsigned char
 osu::Track::expectedStripTECHits () const
 {
-  return (this->hitPattern ().stripTECLayersWithMeasurement ()
-        + this->hitPattern ().stripTECLayersWithoutMeasurement (reco::HitPattern::MISSING_INNER_HITS)
-        + this->hitPattern ().stripTECLayersWithoutMeasurement (reco::HitPattern::TRACK_HITS)
-        + this->hitPattern ().stripTECLayersWithoutMeasurement (reco::HitPattern::MISSING_OUTER_HITS));
+  return this->expectedHits (STRIP_TEC);
 }
 
 const bool
@@ -13,3 +13,7 @@ addChannelArguments.channels = []
 addChannelArguments.histogramSets = cms.VPSet()
 addChannelArguments.collections = cms.PSet()
 
+addChannelArguments.shareCutCalculator = False
+addChannelArguments.selectByIndex = False
+addChannelArguments.lazyBooking = False
+addChannelArguments.sparseHistograms = False
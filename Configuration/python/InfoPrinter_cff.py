@@ -33,4 +33,6 @@ infoPrinter = cms.EDAnalyzer ("InfoPrinter",
     printAllTriggers            =  cms.bool  (False),  # print all triggers in the event
     printAllTriggerFilters      =  cms.bool  (False),  # print all trigger filters in the event
     printAllMETFilters          =  cms.bool  (False),  # print all MET filters in the event
+
+    outputBufferSize            =  cms.uint32  (10 * 1024 * 1024),  # bytes of output to buffer before printing them
 )
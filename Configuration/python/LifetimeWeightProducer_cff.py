@@ -1,9 +1,11 @@
+import re
 import FWCore.ParameterSet.Config as cms
 import OSUT3Analysis.DBTools.osusub_cfg as osusub
 from OSUT3Analysis.Configuration.configurationOptions import *
 
 srcCTau = cms.vdouble ()
 dstCTau = cms.vdouble ()
+dstCTauGrid = cms.vdouble ()
 pdgIds = cms.vint32 ()
 
 if osusub.batchMode:
@@ -21,9 +23,27 @@ if osusub.batchMode:
                 pdgIds.extend (pdgIdsForLifetimeReweighting[osusub.datasetLabel])
             except TypeError:
                 pdgIds.append (pdgIdsForLifetimeReweighting[osusub.datasetLabel])
+            if osusub.datasetLabel in dstCTauGridForLifetimeReweighting:
+                dstCTauGrid.extend (dstCTauGridForLifetimeReweighting[osusub.datasetLabel])
 
 LifetimeWeightProducer = cms.EDFilter ("LifetimeWeightProducer",
     srcCTau = srcCTau,
     dstCTau = dstCTau,
     pdgIds = pdgIds,
+    dstCTauGrid = dstCTauGrid,
 )
+
+# Returns the names of the event variables holding the weights for the given
+# target lifetimes, e.g., lifetimeWeight_0p2 for 0.2 cm. Given as the
+# fluctuations of the lifetimeWeight weight, they make the Plotter fill a copy
+# of every histogram for each target lifetime in the same job:
+#
+#   weights = cms.VPSet (
+#       cms.PSet (
+#           inputCollections = cms.vstring("eventvariables"),
+#           inputVariable = cms.string("lifetimeWeight"),
+#           fluctuations = cms.vstring (lifetimeWeightNames ()),
+#       ),
+#   )
+def lifetimeWeightNames (cTaus = dstCTauGrid):
+    return [re.sub (r'\.', r'p', "lifetimeWeight_%g" % cTau) for cTau in cTaus]
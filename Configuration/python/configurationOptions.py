@@ -8868,6 +8868,16 @@ dstCTauForLifetimeReweighting = {
     # 'stopAndGluino1200_50mm_30mm' : [5.0, 3.0],
 }
 
+dstCTauGridForLifetimeReweighting = {
+    # Defines additional target proper lifetimes (in units of cm/c), each of
+    # which is applied to all of the particles defined by
+    # pdgIdsForLifetimeReweighting. A weight is produced for each in the same
+    # job, named as given by lifetimeWeightNames in
+    # LifetimeWeightProducer_cff.py. The keys are dataset labels and the values
+    # are lists of lifetimes, e.g.:
+    # 'stop1200_50mm'               : [1.0, 2.0, 5.0, 10.0, 20.0, 50.0],
+}
+
 pdgIdsForISRReweighting = {
     # Defines the PDG IDs of the particles to be used for ISR reweighting.
     # This will calculate the vector PT of all hard interaction particles with
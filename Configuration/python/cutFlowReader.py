@@ -0,0 +1,155 @@
+#!/usr/bin/env python
+
+# Shared reader for the cut flows in the merged dataset files.
+#
+# The bin labels, contents and errors of every cut flow, selection and minus
+# one histogram in a file are extracted once and cached in a small sidecar file
+# next to it, e.g., condor/dir/WJets.cutFlows for condor/dir/WJets.root. The
+# sidecar records the size and modification time of the ROOT file and is only
+# used while both still match, so it never needs to be removed by hand. Files
+# without an up-to-date sidecar are read by a pool of worker processes.
+#
+# The sidecar is plain text so that cutFlowTable can read it too:
+#
+#   cutFlows <size of ROOT file> <modification time of ROOT file>
+#   <directory/histogram>\t<number of bins>
+#   <bin label>\t<bin content>\t<bin error>
+#   ...
+
+import os
+import re
+from collections import OrderedDict
+from multiprocessing import Pool, cpu_count
+
+cutFlowSuffixes = ["CutFlow", "cutFlow", "Selection", "selection", "MinusOne", "minusOne"]
+
+class CutFlow:
+    # Mimics the parts of TH1 used by the scripts, with bins numbered from 1.
+
+    def __init__(self, labels, contents, errors):
+        self.labels = labels
+        self.contents = contents
+        self.errors = errors
+
+    def GetNbinsX(self):
+        return len(self.contents)
+
+    def GetBinLabel(self, i):
+        return self.labels[i - 1]
+
+    def GetBinContent(self, i):
+        return self.contents[i - 1]
+
+    def GetBinError(self, i):
+        return self.errors[i - 1]
+
+def sidecarName(fileName):
+    return re.sub(r"\.root$", "", fileName) + ".cutFlows"
+
+def _fileStamp(fileName):
+    status = os.stat(fileName)
+    return (status.st_size, int(status.st_mtime))
+
+def _readSidecar(fileName):
+    try:
+        sidecar = open(sidecarName(fileName))
+        header = sidecar.readline().split()
+        if len(header) != 3 or header[0] != "cutFlows" or (int(header[1]), int(header[2])) != _fileStamp(fileName):
+            return None
+        cutFlows = OrderedDict()
+        line = sidecar.readline()
+        while line:
+            path, nBins = line.rstrip("\n").split("\t")
+            labels, contents, errors = [], [], []
+            for i in range(int(nBins)):
+                label, content, error = sidecar.readline().rstrip("\n").split("\t")
+                labels.append(label)
+                contents.append(float(content))
+                errors.append(float(error))
+            cutFlows[path] = CutFlow(labels, contents, errors)
+            line = sidecar.readline()
+        sidecar.close()
+        return cutFlows
+    except (IOError, OSError, ValueError):
+        return None
+
+def _writeSidecar(fileName, stamp, cutFlows):
+    # Written to a temporary file first, so that a reader never sees a partial
+    # sidecar. A directory which is not writable simply leaves the file uncached.
+    temporaryName = sidecarName(fileName) + "." + str(os.getpid())
+    try:
+        fout = open(temporaryName, "w")
+        fout.write("cutFlows " + str(stamp[0]) + " " + str(stamp[1]) + "\n")
+        for path, cutFlow in cutFlows.iteritems():
+            fout.write(path + "\t" + str(cutFlow.GetNbinsX()) + "\n")
+            for i in range(1, cutFlow.GetNbinsX() + 1):
+                fout.write(cutFlow.GetBinLabel(i) + "\t" + repr(cutFlow.GetBinContent(i)) + "\t" + repr(cutFlow.GetBinError(i)) + "\n")
+        fout.close()
+        os.rename(temporaryName, sidecarName(fileName))
+    except (IOError, OSError):
+        if os.path.exists(temporaryName):
+            os.unlink(temporaryName)
+
+def _extractCutFlows(fileName):
+    # Runs in a worker process. Returns None for a file which cannot be read.
+    from ROOT import TFile
+    try:
+        stamp = _fileStamp(fileName)
+    except OSError:
+        return (fileName, None)
+    inputFile = TFile.Open(fileName)
+    if not inputFile or inputFile.IsZombie():
+        return (fileName, None)
+    cutFlows = OrderedDict()
+    for directoryKey in inputFile.GetListOfKeys():
+        if directoryKey.GetClassName() != "TDirectoryFile":
+            continue
+        directory = inputFile.Get(directoryKey.GetName())
+        for key in directory.GetListOfKeys():
+            path = directoryKey.GetName() + "/" + key.GetName()
+            if not key.GetClassName().startswith("TH1") or path in cutFlows:
+                continue
+            if not any(key.GetName().endswith(suffix) for suffix in cutFlowSuffixes):
+                continue
+            histogram = directory.Get(key.GetName())
+            nBins = histogram.GetNbinsX()
+            cutFlows[path] = CutFlow([histogram.GetXaxis().GetBinLabel(i) for i in range(1, nBins + 1)],
+                                     [histogram.GetBinContent(i) for i in range(1, nBins + 1)],
+                                     [histogram.GetBinError(i) for i in range(1, nBins + 1)])
+    inputFile.Close()
+    _writeSidecar(fileName, stamp, cutFlows)
+    return (fileName, cutFlows)
+
+# Returns a dictionary mapping each of the given files to an OrderedDict of its
+# cut flows keyed by "directory/histogram", or to None if the file could not be
+# read.
+def readCutFlows(fileNames, nProcesses = cpu_count()):
+    results = {}
+    filesToRead = []
+    for fileName in fileNames:
+        cutFlows = _readSidecar(fileName)
+        if cutFlows is not None:
+            results[fileName] = cutFlows
+        elif fileName not in filesToRead:
+            filesToRead.append(fileName)
+
+    if nProcesses > 1 and len(filesToRead) > 1:
+        pool = Pool(min(nProcesses, len(filesToRead)))
+        extracted = pool.map(_extractCutFlows, filesToRead)
+        pool.close()
+        pool.join()
+    else:
+        extracted = map(_extractCutFlows, filesToRead)
+
+    for fileName, cutFlows in extracted:
+        results[fileName] = cutFlows
+    return results
+
+# Returns the directories of the given cut flows, in the order of the file.
+def getCutFlowDirectories(cutFlows):
+    directories = []
+    for path in cutFlows:
+        directory = path.split("/")[0]
+        if directory not in directories:
+            directories.append(directory)
+    return directories
@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+
+# Shared reader for the merged dataset files used by the plotting scripts.
+#
+# The directory tree of each file is indexed on first use, so that histograms
+# can be handed out by path without rereading its key directories. Only the
+# most recently used files are kept open, and every histogram is handed out
+# detached from its file, so that memory use does not grow with the number of
+# files touched. Optionally, all the histograms needed by a script can be read
+# up front by a pool of worker processes.
+
+from collections import OrderedDict
+from multiprocessing import Pool, cpu_count
+from ROOT import TFile, TDirectory
+
+def _indexDirectory(directory, path, index):
+    for key in directory.GetListOfKeys():
+        keyPath = path + "/" + key.GetName() if path else key.GetName()
+        if key.GetClassName() == "TDirectoryFile":
+            _indexDirectory(directory.Get(key.GetName()), keyPath, index)
+        elif keyPath not in index: # keep only the highest cycle of each key
+            index[keyPath] = key.GetClassName()
+
+def _readHistograms(arguments):
+    # Runs in a worker process; the histograms are detached from the file so
+    # that they survive its closing and can be pickled back to the parent.
+    fileName, paths = arguments
+    histograms = {}
+    inputFile = TFile.Open(fileName)
+    if not inputFile or inputFile.IsZombie():
+        return (fileName, histograms)
+    for path in paths:
+        obj = inputFile.Get(path)
+        if not obj:
+            continue
+        if hasattr(obj, "SetDirectory"):
+            obj.SetDirectory(0)
+        histograms[path] = obj
+    inputFile.Close()
+    return (fileName, histograms)
+
+class HistogramReader:
+
+    def __init__(self, maxOpenFiles = 16):
+        self._maxOpenFiles = max(maxOpenFiles, 1)
+        self._files = OrderedDict() # least recently used first
+        self._indices = {}
+        self._cache = {}
+
+    # The returned file is only guaranteed to stay open until another file is
+    # opened through the reader.
+    def open(self, fileName):
+        if fileName in self._files:
+            inputFile = self._files.pop(fileName)
+        else:
+            # opening a file changes gDirectory, which the scripts rely on for
+            # writing their canvases, so restore it afterwards
+            context = TDirectory.TContext()
+            inputFile = TFile.Open(fileName)
+            del context
+            if inputFile and inputFile.IsZombie():
+                inputFile = None
+            while len(self._files) >= self._maxOpenFiles:
+                oldFileName, oldFile = self._files.popitem(last = False)
+                if oldFile:
+                    oldFile.Close()
+        self._files[fileName] = inputFile
+        return inputFile
+
+    def index(self, fileName):
+        if fileName not in self._indices:
+            index = {}
+            inputFile = self.open(fileName)
+            if inputFile:
+                _indexDirectory(inputFile, "", index)
+            self._indices[fileName] = index
+        return self._indices[fileName]
+
+    def contains(self, fileName, path):
+        return path.strip("/") in self.index(fileName)
+
+    # Returns the object detached from its file, so it stays valid after the
+    # file is closed. A prefetched object is handed out once and then dropped
+    # from the cache; asking for it again reads it from the file.
+    def get(self, fileName, path):
+        path = path.strip("/")
+        if (fileName, path) in self._cache:
+            return self._cache.pop((fileName, path))
+        if path not in self.index(fileName):
+            return None
+        obj = self.open(fileName).Get(path)
+        if obj and hasattr(obj, "SetDirectory"):
+            obj.SetDirectory(0)
+        return obj
+
+    # requests is a list of (fileName, path) pairs. Each file is read by a
+    # single worker so that it is still opened only once.
+    def prefetch(self, requests, nProcesses = cpu_count()):
+        pathsByFile = {}
+        for fileName, path in requests:
+            path = path.strip("/")
+            if (fileName, path) in self._cache or not self.contains(fileName, path):
+                continue
+            pathsByFile.setdefault(fileName, []).append(path)
+        if not pathsByFile:
+            return
+
+        tasks = sorted(pathsByFile.items())
+        if nProcesses > 1 and len(tasks) > 1:
+            pool = Pool(min(nProcesses, len(tasks)))
+            results = pool.map(_readHistograms, tasks)
+            pool.close()
+            pool.join()
+        else:
+            results = map(_readHistograms, tasks)
+
+        for fileName, histograms in results:
+            for path, histogram in histograms.iteritems():
+                self._cache[(fileName, path)] = histogram
+
+    def close(self):
+        for inputFile in self._files.values():
+            if inputFile:
+                inputFile.Close()
+        self._files = OrderedDict()
+        self._indices = {}
+        self._cache = {}
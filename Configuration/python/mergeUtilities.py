@@ -9,12 +9,14 @@ import subprocess
 import pickle
 import shutil
 import math
-from threading import Thread, Lock, Semaphore
-from multiprocessing import cpu_count
+from Queue import Queue
+from multiprocessing import Pool, cpu_count
+from multiprocessing.pool import ThreadPool
 from OSUT3Analysis.Configuration.configurationOptions import *
 from OSUT3Analysis.Configuration.processingUtilities import *
 from OSUT3Analysis.Configuration.formattingUtilities import *
 from OSUT3Analysis.DBTools.condorSubArgumentsSet import *
+from OSUT3Analysis.DBTools.metadataCache import MetadataCache
 import FWCore.ParameterSet.Config as cms
 from ROOT import TFile
 
@@ -96,41 +98,56 @@ def MakeWeightsString(Weight,FilesSet):
 ###############################################################################
 #   Get the total number of events from cutFlows to calculate the weights     #
 ###############################################################################
-def GetNumberOfEvents(FilesSet):
+def GetNumberOfEvents(FilesSet, Cache = None):
     NumberOfEvents = {'SkimNumber' : {}, 'TotalNumber' : 0}
-    for File in FilesSet:
-        ScoutFile = TFile(File)
-        if ScoutFile.IsZombie():
-            print File + " is a bad root file."
-            FilesSet.remove(File)
-            continue
-        randomChannelDirectory = ""
-        TotalNumberTmp = 0
-        for key in ScoutFile.GetListOfKeys():
-            if key.GetClassName() != "TDirectoryFile" or "CutFlow" not in key.GetName():
+    for File in list(FilesSet):
+        CutFlowTotals = Cache.get(File, 'cutFlowTotals') if Cache else None
+        if CutFlowTotals is None:
+            CutFlowTotals = GetCutFlowTotals(File)
+            if CutFlowTotals is None:
+                FilesSet.remove(File)
                 continue
-            randomChannelDirectory = key.GetName()
-            channelName = randomChannelDirectory[0:len(randomChannelDirectory)-14]
+            if Cache:
+                Cache.set(File, 'cutFlowTotals', CutFlowTotals)
+        for channelName in CutFlowTotals['SkimNumber']:
             if not NumberOfEvents['SkimNumber'].has_key(channelName):
                 NumberOfEvents['SkimNumber'][channelName] = 0
-            OriginalCounterObj = ScoutFile.Get(randomChannelDirectory + "/eventCounter")
-            SkimCounterObj = ScoutFile.Get(randomChannelDirectory + "/cutFlow")
-            TotalNumberTmp = 0
-            if not OriginalCounterObj:
-                print "Could not find eventCounter histogram in " + str(File) + " !"
-                continue
-            elif not SkimCounterObj:
-                print "Could not find cutFlow histogram in " + str(File) + " !"
-            else:
-                OriginalCounter = OriginalCounterObj.Clone()
-                OriginalCounter.SetDirectory(0)
-                TotalNumberTmp = TotalNumberTmp + OriginalCounter.GetBinContent(1)
-                SkimCounter = SkimCounterObj.Clone()
-                SkimCounter.SetDirectory(0)
-                NumberOfEvents['SkimNumber'][channelName] = NumberOfEvents['SkimNumber'][channelName] + SkimCounter.GetBinContent(SkimCounter.GetXaxis().GetNbins())
-        NumberOfEvents['TotalNumber'] = NumberOfEvents['TotalNumber'] + TotalNumberTmp
+            NumberOfEvents['SkimNumber'][channelName] = NumberOfEvents['SkimNumber'][channelName] + CutFlowTotals['SkimNumber'][channelName]
+        NumberOfEvents['TotalNumber'] = NumberOfEvents['TotalNumber'] + CutFlowTotals['TotalNumber']
     return NumberOfEvents
 ###############################################################################
+#     Get the cut flow totals of a single file, or None if it is unreadable   #
+###############################################################################
+def GetCutFlowTotals(File):
+    CutFlowTotals = {'SkimNumber' : {}, 'TotalNumber' : 0}
+    ScoutFile = TFile(File)
+    if ScoutFile.IsZombie():
+        print File + " is a bad root file."
+        return None
+    randomChannelDirectory = ""
+    TotalNumberTmp = 0
+    for key in ScoutFile.GetListOfKeys():
+        if key.GetClassName() != "TDirectoryFile" or "CutFlow" not in key.GetName():
+            continue
+        randomChannelDirectory = key.GetName()
+        channelName = randomChannelDirectory[0:len(randomChannelDirectory)-14]
+        if not CutFlowTotals['SkimNumber'].has_key(channelName):
+            CutFlowTotals['SkimNumber'][channelName] = 0
+        OriginalCounterObj = ScoutFile.Get(randomChannelDirectory + "/eventCounter")
+        SkimCounterObj = ScoutFile.Get(randomChannelDirectory + "/cutFlow")
+        TotalNumberTmp = 0
+        if not OriginalCounterObj:
+            print "Could not find eventCounter histogram in " + str(File) + " !"
+            continue
+        elif not SkimCounterObj:
+            print "Could not find cutFlow histogram in " + str(File) + " !"
+        else:
+            TotalNumberTmp = TotalNumberTmp + OriginalCounterObj.GetBinContent(1)
+            CutFlowTotals['SkimNumber'][channelName] = CutFlowTotals['SkimNumber'][channelName] + SkimCounterObj.GetBinContent(SkimCounterObj.GetXaxis().GetNbins())
+    CutFlowTotals['TotalNumber'] = TotalNumberTmp
+    ScoutFile.Close()
+    return CutFlowTotals
+###############################################################################
 #                 Produce important files for the skim directory.             #
 ###############################################################################
 def MakeFilesForSkimDirectory(Directory, DirectoryOut, TotalNumber, SkimNumber, BadIndices, FilesToRemove):
@@ -245,55 +262,135 @@ def MakeResubmissionScript(badIndices, originalSubmissionScript):
 ###############################################################################
 #                       Determine whether a skim file is valid.               #
 ###############################################################################
-def SkimFileValidator(File):
+def SkimFileValidator(File, Cache = None):
+    Validation = Cache.get(File, 'skimValidation') if Cache else None
+    if Validation is not None:
+        return Validation[0], Validation[1]
     print "testing ", File
+    File, Valid, InvalidOrEmpty, NumberOfEvents = ValidateSkimFile(File)
+    if Cache:
+        CacheSkimValidation(Cache, File, Valid, InvalidOrEmpty, NumberOfEvents)
+    return Valid, InvalidOrEmpty
+
+# Also used as the worker function of the validation pool, so it only returns
+# the results rather than caching them.
+def ValidateSkimFile(File):
     FileToTest = TFile(File)
     Valid = True
     for TreeToTest in ['MetaData', 'ParameterSets', 'Parentage', 'Events', 'LuminosityBlocks', 'Runs']:
         Valid = Valid and (FileToTest.Get(TreeToTest) != None)
-    InvalidOrEmpty = not Valid or not FileToTest.Get ("Events").GetEntries ()
-    return Valid, InvalidOrEmpty
+    NumberOfEvents = int(FileToTest.Get ("Events").GetEntries ()) if Valid else -1
+    InvalidOrEmpty = not Valid or not NumberOfEvents
+    FileToTest.Close()
+    return File, Valid, InvalidOrEmpty, NumberOfEvents
+
+def CacheSkimValidation(Cache, File, Valid, InvalidOrEmpty, NumberOfEvents):
+    Cache.set(File, 'skimValidation', [Valid, InvalidOrEmpty])
+    if Valid:
+        Cache.set(File, 'events', NumberOfEvents)
+
+###############################################################################
+#        Determine whether each of a list of skim files is valid, using a     #
+#        pool of processes for the files which are not already cached.        #
+###############################################################################
+def ValidateSkimFiles(Files, Cache, nProcesses):
+    Validations = {}
+    FilesToTest = []
+    for File in Files:
+        Validation = Cache.get(File, 'skimValidation')
+        if Validation is not None:
+            Validations[File] = (Validation[0], Validation[1])
+        else:
+            FilesToTest.append(File)
+    if FilesToTest:
+        print "testing " + str(len(FilesToTest)) + " skim files"
+        if nProcesses > 1 and len(FilesToTest) > 1:
+            pool = Pool(min(nProcesses, len(FilesToTest)))
+            results = pool.map(ValidateSkimFile, FilesToTest)
+            pool.close()
+            pool.join()
+        else:
+            results = map(ValidateSkimFile, FilesToTest)
+        for File, Valid, InvalidOrEmpty, NumberOfEvents in results:
+            CacheSkimValidation(Cache, File, Valid, InvalidOrEmpty, NumberOfEvents)
+            Validations[File] = (Valid, InvalidOrEmpty)
+    return Validations
 
 ###############################################################################
-#                   Merge an intermediate file with a thread.                 #
+#             Run a merging command and return its output for the log.        #
 ###############################################################################
-threadLog = ""
-outputFiles = []
-lock = Lock () # to control appending to threadLog and outputFiles
-semaphore = None # to control how many merging threads are active at a given time
-def MergeIntermediateFile (files, outputDir, dataset, weight, threadIndex, verbose):
-    global threadLog
-    global outputFiles
-    global lock
-    global semaphore
-    localThreadLog = ""
-
-    weightString = MakeWeightsString(weight, files)
-    outputFile = dataset + '_' + str (threadIndex) + '.root'
-    cmd = 'mergeTFileServiceHistograms -i ' + " ".join (files) + ' -o ' + outputDir + "/" + outputFile + ' -w ' + weightString
-
-    semaphore.acquire ()
+def RunMergingCommand (cmd, verbose):
     if verbose:
         print "Executing: ", cmd
     try:
-        localThreadLog += subprocess.check_output (cmd.split (), stderr = subprocess.STDOUT)
+        return subprocess.check_output (cmd.split (), stderr = subprocess.STDOUT)
     except subprocess.CalledProcessError as e:
-        localThreadLog += e.output
-    semaphore.release ()
+        return e.output
+    except OSError as e:
+        return "Failed to execute " + cmd + ": " + str (e) + "\n"
 
-    lock.acquire ()
-    threadLog += localThreadLog
-    outputFiles.append (outputDir + '/' + outputFile)
-    lock.release ()
+###############################################################################
+#    Merge histogram files as a tree reduction. Groups of at most fanIn files #
+#    are merged into intermediate files, each of which is merged in turn as   #
+#    soon as enough of its siblings are ready, until a single file remains.   #
+#    The weight is applied when merging the input files. The first level is   #
+#    split finely enough to keep all of the threads of the pool busy.         #
+###############################################################################
+def MergeHierarchically (files, weight, outputFile, fanIn, pool, nThreads, verbose):
+    fanIn = max (2, fanIn)
+    groupSizes = [min (fanIn, max (2, int (math.ceil (len (files) / float (nThreads)))))]
+    nFiles = [len (files)]
+    while nFiles[-1] > groupSizes[-1]:
+        nFiles.append (int (math.ceil (nFiles[-1] / float (groupSizes[-1]))))
+        groupSizes.append (fanIn)
+    finalLevel = len (nFiles) - 1
+
+    completed = Queue ()
+    waiting = [[] for n in nFiles]
+    arrived = [0 for n in nFiles]
+    intermediateFiles = []
+    waiting[0] = list (files)
+    arrived[0] = len (files)
+
+    def launch (level):
+        inputs = waiting[level][:groupSizes[level]]
+        del waiting[level][:groupSizes[level]]
+        if level == finalLevel:
+            output = outputFile
+        else:
+            output = re.sub (r"\.root$", "", outputFile) + "_" + str (level) + "_" + str (len (intermediateFiles)) + ".root"
+            intermediateFiles.append (output)
+        cmd = 'mergeTFileServiceHistograms -i ' + " ".join (inputs) + ' -o ' + output
+        if level == 0:
+            cmd += ' -w ' + MakeWeightsString (weight, inputs)
+        pool.apply_async (RunMergingCommand, (cmd, verbose), callback = lambda cmdLog: completed.put ((level + 1, output, cmdLog)))
+
+    log = ""
+    nRunning = 0
+    while True:
+        for level in range (0, len (nFiles)):
+            while len (waiting[level]) >= groupSizes[level] or (waiting[level] and arrived[level] == nFiles[level]):
+                launch (level)
+                nRunning += 1
+        if not nRunning:
+            break
+        level, output, cmdLog = completed.get ()
+        nRunning -= 1
+        log += cmdLog
+        if level <= finalLevel:
+            waiting[level].append (output)
+            arrived[level] += 1
+
+    # remove the intermediate files produced above
+    for intermediateFile in intermediateFiles:
+        if os.path.exists (intermediateFile):
+            os.unlink (intermediateFile)
+    return log
 
 ###############################################################################
 #                       Main function to do merging work.                     #
 ###############################################################################
-def mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir="", nThreadsActive = cpu_count () + 1, verbose = False):
-    global threadLog
-    global outputFiles
-    global semaphore
-
+def mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir="", nThreadsActive = cpu_count () + 1, verbose = False, fanIn = 100, mergeSkims = False):
     os.chdir(CondorDir)
     directory = CondorDir + '/' + dataSet
     if not os.path.exists(directory):
@@ -319,6 +416,9 @@ def mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir="", nThreadsActive =
         print "no jobs were run for dataset '" + dataSet + "', will skip it and continue!"
         return
     LogFiles = os.popen('ls condor_*.log').readlines()
+    # Event counts, cut flow totals and skim validation results are cached
+    # so that re-running the merging does not reopen every file.
+    Cache = MetadataCache(directory + '/metadataCache.json')
     if verbose:
         print "parsing log files to find good jobs"
 
@@ -343,19 +443,28 @@ def mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir="", nThreadsActive =
     # check for any corrupted skim output files
     skimDirs = [member for member in  os.listdir(os.getcwd()) if os.path.isdir(member)]
     FilesToRemove = []
+    skimFiles = []
     for channel in skimDirs:
         for skimFile in glob.glob(channel+'/*.root'):
             # don't check for good skims of jobs we already know are bad
             index = skimFile.split('.')[0].split('_')[1]
             if index in BadIndices:
                 continue
-            Valid, InvalidOrEmpty = SkimFileValidator(skimFile.rstrip('\n'))
+            skimFiles.append(skimFile.rstrip('\n'))
+    Validations = ValidateSkimFiles(skimFiles, Cache, nThreadsActive)
+    for channel in skimDirs:
+        for skimFile in glob.glob(channel+'/*.root'):
+            index = skimFile.split('.')[0].split('_')[1]
+            if index in BadIndices or skimFile.rstrip('\n') not in Validations:
+                continue
+            Valid, InvalidOrEmpty = Validations[skimFile.rstrip('\n')]
             if not Valid:
                 BadIndices.append(index)
                 if verbose:
                     print "  job" + ' ' * (4-len(str(index))) + index + " had bad skim output file"
             if InvalidOrEmpty:
                 FilesToRemove.append (skimFile)
+    Cache.save()
 
 
     # check for abnormal condor return values
@@ -390,8 +499,10 @@ def mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir="", nThreadsActive =
         return
     exec('import datasetInfo_' + dataSet + '_cfg as datasetInfo')
 
-    TotalNumber = GetNumberOfEvents(GoodRootFiles)['TotalNumber']
-    SkimNumber = GetNumberOfEvents(GoodRootFiles)['SkimNumber']
+    NumberOfEvents = GetNumberOfEvents(GoodRootFiles, Cache)
+    Cache.save()
+    TotalNumber = NumberOfEvents['TotalNumber']
+    SkimNumber = NumberOfEvents['SkimNumber']
     if verbose:
         print "TotalNumber =", TotalNumber, ", SkimNumber =", SkimNumber
     if not TotalNumber:
@@ -417,40 +528,32 @@ def mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir="", nThreadsActive =
     else:
         MakeFilesForSkimDirectory(directory, directoryOut, TotalNumber, SkimNumber, BadIndices, FilesToRemove)
 
-    threadLog = ""
-    outputFiles = []
-    semaphore = Semaphore (nThreadsActive)
-
-    # start threads, each of which merges some fraction of the input files
-    filesPerThread = 100 # to be adjusted if need be
-    nThreadTarget = cpu_count () + 1
-    nFiles = len (GoodRootFiles)
-    nThreads = int (math.ceil (float (nFiles) / float (filesPerThread)))
-    if nThreads < nThreadTarget:
-        nThreads = min (nThreadTarget, nFiles)
-        filesPerThread = int (math.ceil (float (nFiles) / float (nThreads)))
-    threads = []
-    for i in range (0, nThreads):
-        fileSubset = GoodRootFiles[(i * filesPerThread):((i + 1) * filesPerThread)]
-        if len (fileSubset):
-            threads.append (Thread (target = MergeIntermediateFile, args = (fileSubset, OutputDir, dataSet, Weight, i, verbose)))
-            threads[-1].start ()
-    for thread in threads:
-        thread.join ()
-    log += threadLog
-
-    # merge the intermediate files produced by the threads above
-    cmd = 'mergeTFileServiceHistograms -i ' + " ".join (outputFiles) + ' -o ' + OutputDir + "/" + dataSet + '.root'
-    if verbose:
-        print "Executing: ", cmd
-    try:
-        log += subprocess.check_output (cmd.split (), stderr = subprocess.STDOUT)
-    except subprocess.CalledProcessError as e:
-        log += e.output
+    pool = ThreadPool (nThreadsActive)
+
+    # merge the skim files of each channel concurrently with the histograms
+    skimMerges = []
+    if mergeSkims:
+        for channel in skimDirs:
+            channelSkimFiles = []
+            for skimFile in sorted(glob.glob(directory + '/' + channel + '/*.root')):
+                index = skimFile.split('/')[-1].split('.')[0].split('_')[1]
+                if index in BadIndices or os.path.relpath(skimFile, directory) in FilesToRemove:
+                    continue
+                channelSkimFiles.append("file:" + skimFile)
+            if not channelSkimFiles:
+                continue
+            try:
+                os.makedirs (directoryOut + '/' + channel + '/merged')
+            except OSError:
+                pass
+            cmd = 'edmCopyPickMerge inputFiles=' + ",".join (channelSkimFiles) + ' outputFile=' + directoryOut + '/' + channel + '/merged/skimMerged.root'
+            skimMerges.append (pool.apply_async (RunMergingCommand, (cmd, verbose)))
 
-    # remove the intermediate files produced by the threads above
-    for outputFile in outputFiles:
-        os.unlink (outputFile)
+    log += MergeHierarchically (GoodRootFiles, Weight, OutputDir + "/" + dataSet + '.root', fanIn, pool, nThreadsActive, verbose)
+    for skimMerge in skimMerges:
+        log += skimMerge.get ()
+    pool.close ()
+    pool.join ()
 
     log += "\nFinished merging dataset " + dataSet + ":\n"
     log += "    "+ str(len(GoodRootFiles)) + " good files are used for merging out of " + str(len(LogFiles)) + " submitted jobs.\n"
@@ -7,6 +7,7 @@ import datetime
 import time
 import copy
 import pickle
+import hashlib
 import FWCore.ParameterSet.Modules
 from optparse import OptionParser
 import OSUT3Analysis.DBTools.osusub_cfg as osusub
@@ -187,8 +188,117 @@ def get_collections (cuts):
     return sorted (list (collections))
     ############################################################################
 
+################################################################################
+# Object producers of the same type with the same configuration produce
+# identical collections, so each distinct one is added to the process only once
+# and shared between all the channels which need it. Returns the label of the
+# producer to use.
+################################################################################
+def add_object_producer (process, collection, objectProducer):
+    if not hasattr (add_object_producer, "producers"):
+        add_object_producer.producers = {}
+    key = (collection, hashlib.sha1 (objectProducer.dumpPython ()).hexdigest ())
+    if key not in add_object_producer.producers or not hasattr (process, add_object_producer.producers[key]):
+        label = "objectProducer" + str (add_channels.producerIndex)
+        setattr (process, label, objectProducer)
+        add_object_producer.producers[key] = label
+        add_channels.producerIndex += 1
+    return add_object_producer.producers[key]
+
+################################################################################
+# Creates an OSU object producer for each collection used in the given cuts or
+# in the other collections, e.g., those used in histograms and weights.
+# Producers already created with the same configuration are reused rather than
+# cloned. Returns the collections PSet pointing to the produced collections,
+# the labels of the producers, and the output commands dropping the original
+# collections which are cut on.
+################################################################################
+def add_object_producers (process, collections, cutCollections, otherCollections):
+    # The following collections are meant to be produced before any others.
+    # This is usually necessary because the production of other collections
+    # depends on these.
+    collectionsToProduce = [
+        "mets",         # needed in order to use metNoMu in the lepton collections
+        "mcparticles",  # needed for gen-matching
+    ]
+
+    producedCollections = copy.deepcopy (collections)
+    objectProducerLabels = []
+    dropCommands = []
+    usedCollections = sorted (list (set (cutCollections + otherCollections)))
+    for collection in collectionsToProduce:
+        if collection in usedCollections:
+            usedCollections.remove (collection)
+        if hasattr (collections, collection):
+            usedCollections.insert (0, collection)
+    for collection in usedCollections:
+        if collection is "uservariables" or collection is "eventvariables":
+            newInputTags = cms.VInputTag()
+            if hasattr (collections, collection):
+                inputTags = getattr (collections, collection)
+            else:
+                inputTags = cms.VInputTag()
+            for inputTag in inputTags:
+                eventvariableCollections = copy.deepcopy (collections)
+                setattr (eventvariableCollections, collection, cms.InputTag ("",""))
+                setattr (eventvariableCollections, collection,inputTag)
+                objectProducer = getattr (collectionProducer, collection).clone()
+                objectProducer.collections = eventvariableCollections
+                # Set the input tag for mcparticles to that produced by the
+                # first object producer. Needed for gen-matching to work. DO
+                # NOT ERASE!!!
+                if collection != "mcparticles":
+                    label = getattr (collections, "mcparticles").getProductInstanceLabel () if hasattr (collections, "mcparticles") else ""
+                    setattr (objectProducer.collections, "mcparticles", cms.InputTag ("objectProducer0", label))
+                # Set the input tag for mets to that produced by the second
+                # object producer. Needed for metNoMu. DO NOT ERASE!!!
+                if collection != "mcparticles" and collection != "mets":
+                    label = getattr (collections, "mets").getProductInstanceLabel () if hasattr (collections, "mets") else ""
+                    setattr (objectProducer.collections, "mets", cms.InputTag ("objectProducer1", label))
+                objectProducerLabel = add_object_producer (process, collection, objectProducer)
+                objectProducerLabels.append (objectProducerLabel)
+                newInputTags.append(cms.InputTag (objectProducerLabel, inputTag.getProductInstanceLabel ()))
+                if collection in cutCollections:
+                    dropCommand = "drop *_" + inputTag.getModuleLabel () + "_" + inputTag.getProductInstanceLabel () + "_"
+                    if inputTag.getProcessName ():
+                        dropCommand += inputTag.getProcessName ()
+                    else:
+                        dropCommand += "*"
+                    dropCommands.append (dropCommand)
+                # if collection not in cutCollections:
+                #     outputCommands.append ("keep *_" + objectProducerLabel + "_" + inputTag.getProductInstanceLabel () + "_" + process.name_ ())
+            setattr (producedCollections, collection, newInputTags)
+        else:
+            objectProducer = getattr (collectionProducer, collection).clone()
+            objectProducer.collections = copy.deepcopy (collections)
+            # Set the input tag for mcparticles to that produced by the
+            # first object producer. Needed for gen-matching to work. DO
+            # NOT ERASE!!!
+            if collection != "mcparticles":
+                label = getattr (collections, "mcparticles").getProductInstanceLabel () if hasattr (collections, "mcparticles") else ""
+                setattr (objectProducer.collections, "mcparticles", cms.InputTag ("objectProducer0", label))
+            # Set the input tag for mets to that produced by the second
+            # object producer. Needed for metNoMu. DO NOT ERASE!!!
+            if collection != "mcparticles" and collection != "mets":
+                label = getattr (collections, "mets").getProductInstanceLabel () if hasattr (collections, "mets") else ""
+                setattr (objectProducer.collections, "mets", cms.InputTag ("objectProducer1", label))
+            objectProducerLabel = add_object_producer (process, collection, objectProducer)
+            objectProducerLabels.append (objectProducerLabel)
+            originalInputTag = getattr (collections, collection)
+            setattr (producedCollections, collection, cms.InputTag (objectProducerLabel, originalInputTag.getProductInstanceLabel ()))
+            if collection in cutCollections:
+                dropCommand = "drop *_" + originalInputTag.getModuleLabel () + "_" + originalInputTag.getProductInstanceLabel () + "_"
+                if originalInputTag.getProcessName ():
+                    dropCommand += originalInputTag.getProcessName ()
+                else:
+                    dropCommand += "*"
+                dropCommands.append (dropCommand)
+            # if collection not in cutCollections:
+            #     outputCommands.append ("keep *_" + objectProducerLabel + "_" + originalInputTag.getProductInstanceLabel () + "_" + process.name_ ())
+    return (producedCollections, objectProducerLabels, dropCommands)
+
 #def add_channels (process, channels, histogramSets, weights, scalingfactorproducers, collections, variableProducers, skim = True, branchSets):
-def add_channels (process, channels, histogramSets = None, weights = None, scalingfactorproducers = None, collections = None, variableProducers = None, skim = None, branchSets = None):
+def add_channels (process, channels, histogramSets = None, weights = None, scalingfactorproducers = None, collections = None, variableProducers = None, skim = None, branchSets = None, shareCutCalculator = False, selectByIndex = False, lazyBooking = False, sparseHistograms = False):
     if skim is not None:
         print "# The \"skim\" parameter of add_channels is obsolete and will soon be deprecated."
         print "# Please remove from your config files."
@@ -205,6 +315,10 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
         standAloneAnalyzers     =  channels.standAloneAnalyzers
         histogramSets           =  channels.histogramSets
         collections             =  channels.collections
+        shareCutCalculator      =  getattr (channels, "shareCutCalculator", False)
+        selectByIndex           =  getattr (channels, "selectByIndex", False)
+        lazyBooking             =  getattr (channels, "lazyBooking", False)
+        sparseHistograms        =  getattr (channels, "sparseHistograms", False)
         channels                =  channels.channels
 
     ############################################################################
@@ -284,6 +398,8 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
         add_channels.standAloneAnalyzerIndex = 0
     if not hasattr (add_channels, "filterIndex"):
         add_channels.filterIndex = 0
+    if not hasattr (add_channels, "sharedCutCalculatorIndex"):
+        add_channels.sharedCutCalculatorIndex = 0
     if not hasattr (add_channels, "endPath"):
         add_channels.endPath = cms.EndPath ()
     ############################################################################
@@ -328,6 +444,7 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
     plotCollections = get_collections (histogramSets)
     weightCollections = get_collections (weights)
 
+    sharedCutCalculatorLabel = None
     for channel in channels:
         channelPath = cms.Path ()
         channelName = channel.name.pythonValue ()
@@ -466,103 +583,70 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
             outputCommands.append (outputCommand)
         ########################################################################
 
-        # The following collections are meant to be produced before any others.
-        # This is usually necessary because the production of other collections
-        # depends on these.
-        collectionsToProduce = [
-            "mets",         # needed in order to use metNoMu in the lepton collections
-            "mcparticles",  # needed for gen-matching
-        ]
+        ########################################################################
+        # If requested, the cuts of all the channels are evaluated by a single
+        # cut calculator, which only evaluates once the leading cuts common to
+        # several channels. It needs the object producers of every channel, so
+        # it runs in its own path, scheduled before any of the channel paths.
+        ########################################################################
+        if shareCutCalculator and sharedCutCalculatorLabel is None:
+            sharedChannels = [c for c in channels if not hasattr (process, c.name.pythonValue ()[1:-1])]
+            # The shared cut calculator puts the products of each channel under
+            # its name without underscores, which are not allowed in product
+            # instance labels, so these must be unique.
+            channelsByLabel = {}
+            for c in sharedChannels:
+                channelsByLabel.setdefault (c.name.pythonValue ()[1:-1].replace ("_", ""), []).append (c.name.pythonValue ()[1:-1])
+            clashingChannels = [names for label, names in sorted (channelsByLabel.items ()) if len (names) > 1]
+            if clashingChannels:
+                print "ERROR:  The shared cut calculator needs channel names which are unique once underscores are removed."
+                for names in clashingChannels:
+                    print "These channels clash:", ", ".join (names)
+                print "Please rename the channels or do not use shareCutCalculator."
+                sys.exit(1)
+            allCutCollections = sorted (list (set (sum ([get_collections (c.cuts) for c in sharedChannels], []))))
+            sharedCollections, objectProducerLabels, dropCommands = add_object_producers (process, collections, allCutCollections, plotCollections + weightCollections)
+            sharedCutCalculatorPath = cms.Path ()
+            for objectProducerLabel in objectProducerLabels:
+                sharedCutCalculatorPath += getattr (process, objectProducerLabel)
+            sharedCutCalculator = cms.EDProducer ("CutCalculator",
+                collections = sharedCollections,
+                channels = cms.VPSet (*[copy.deepcopy (c) for c in sharedChannels])
+            )
+            sharedCutCalculatorLabel = "sharedCutCalculator" + str (add_channels.sharedCutCalculatorIndex)
+            setattr (process, sharedCutCalculatorLabel, sharedCutCalculator)
+            sharedCutCalculatorPath += sharedCutCalculator
+            setattr (process, sharedCutCalculatorLabel + "Path", sharedCutCalculatorPath)
+            process.schedule.append (sharedCutCalculatorPath)
+            add_channels.sharedCutCalculatorIndex += 1
+        ########################################################################
 
         ########################################################################
         # Add an OSU object producer for each collection used in a cut or
         # histogram.
         ########################################################################
-        producedCollections = copy.deepcopy (collections)
         cutCollections = get_collections (channel.cuts)
-        usedCollections = sorted (list (set (cutCollections + plotCollections + weightCollections)))
-        for collection in collectionsToProduce:
-            if collection in usedCollections:
-                usedCollections.remove (collection)
-            if hasattr (collections, collection):
-                usedCollections.insert (0, collection)
-        for collection in usedCollections:
-            if collection is "uservariables" or collection is "eventvariables":
-                newInputTags = cms.VInputTag()
-                if hasattr (collections, collection):
-                    inputTags = getattr (collections, collection)
-                else:
-                    inputTags = cms.VInputTag()
-                for inputTag in inputTags:
-                    eventvariableCollections = copy.deepcopy (collections)
-                    setattr (eventvariableCollections, collection, cms.InputTag ("",""))
-                    setattr (eventvariableCollections, collection,inputTag)
-                    objectProducer = getattr (collectionProducer, collection).clone()
-                    objectProducer.collections = eventvariableCollections
-                    # Set the input tag for mcparticles to that produced by the
-                    # first object producer. Needed for gen-matching to work. DO
-                    # NOT ERASE!!!
-                    if collection != "mcparticles":
-                        label = getattr (collections, "mcparticles").getProductInstanceLabel () if hasattr (collections, "mcparticles") else ""
-                        setattr (objectProducer.collections, "mcparticles", cms.InputTag ("objectProducer0", label))
-                    # Set the input tag for mets to that produced by the second
-                    # object producer. Needed for metNoMu. DO NOT ERASE!!!
-                    if collection != "mcparticles" and collection != "mets":
-                        label = getattr (collections, "mets").getProductInstanceLabel () if hasattr (collections, "mets") else ""
-                        setattr (objectProducer.collections, "mets", cms.InputTag ("objectProducer1", label))
-                    channelPath += objectProducer
-                    setattr (process, "objectProducer" + str (add_channels.producerIndex), objectProducer)
-                    newInputTags.append(cms.InputTag ("objectProducer" + str (add_channels.producerIndex), inputTag.getProductInstanceLabel ()))
-                    if collection in cutCollections:
-                        dropCommand = "drop *_" + inputTag.getModuleLabel () + "_" + inputTag.getProductInstanceLabel () + "_"
-                        if inputTag.getProcessName ():
-                            dropCommand += inputTag.getProcessName ()
-                        else:
-                            dropCommand += "*"
-                        outputCommands.append (dropCommand)
-                    # if collection not in cutCollections:
-                    #     outputCommands.append ("keep *_objectProducer" + str (add_channels.producerIndex) + "_" + inputTag.getProductInstanceLabel () + "_" + process.name_ ())
-                    add_channels.producerIndex += 1
-                setattr (producedCollections, collection, newInputTags)
-            else:
-                objectProducer = getattr (collectionProducer, collection).clone()
-                objectProducer.collections = copy.deepcopy (collections)
-                # Set the input tag for mcparticles to that produced by the
-                # first object producer. Needed for gen-matching to work. DO
-                # NOT ERASE!!!
-                if collection != "mcparticles":
-                    label = getattr (collections, "mcparticles").getProductInstanceLabel () if hasattr (collections, "mcparticles") else ""
-                    setattr (objectProducer.collections, "mcparticles", cms.InputTag ("objectProducer0", label))
-                # Set the input tag for mets to that produced by the second
-                # object producer. Needed for metNoMu. DO NOT ERASE!!!
-                if collection != "mcparticles" and collection != "mets":
-                    label = getattr (collections, "mets").getProductInstanceLabel () if hasattr (collections, "mets") else ""
-                    setattr (objectProducer.collections, "mets", cms.InputTag ("objectProducer1", label))
-                channelPath += objectProducer
-                setattr (process, "objectProducer" + str (add_channels.producerIndex), objectProducer)
-                originalInputTag = getattr (collections, collection)
-                setattr (producedCollections, collection, cms.InputTag ("objectProducer" + str (add_channels.producerIndex), originalInputTag.getProductInstanceLabel ()))
-                if collection in cutCollections:
-                    dropCommand = "drop *_" + originalInputTag.getModuleLabel () + "_" + originalInputTag.getProductInstanceLabel () + "_"
-                    if originalInputTag.getProcessName ():
-                        dropCommand += originalInputTag.getProcessName ()
-                    else:
-                        dropCommand += "*"
-                    outputCommands.append (dropCommand)
-                # if collection not in cutCollections:
-                #     outputCommands.append ("keep *_objectProducer" + str (add_channels.producerIndex) + "_" + originalInputTag.getProductInstanceLabel () + "_" + process.name_ ())
-                add_channels.producerIndex += 1
+        producedCollections, objectProducerLabels, dropCommands = add_object_producers (process, collections, cutCollections, plotCollections + weightCollections)
+        for objectProducerLabel in objectProducerLabels:
+            channelPath += getattr (process, objectProducerLabel)
+        outputCommands.extend (dropCommands)
         ########################################################################
 
         ########################################################################
-        # Add a cut calculator module for this channel to the path.
+        # Add a cut calculator module for this channel to the path, or the
+        # shared one if it is being used.
         ########################################################################
-        cutCalculator = cms.EDProducer ("CutCalculator",
-            collections = producedCollections,
-            cuts = channel
-        )
-        channelPath += cutCalculator
-        setattr (process, channelName + "CutCalculator", cutCalculator)
+        if sharedCutCalculatorLabel is not None:
+            channelPath += getattr (process, sharedCutCalculatorLabel)
+            cutDecisions = cms.InputTag (sharedCutCalculatorLabel, channelName.replace ("_", ""))
+        else:
+            cutCalculator = cms.EDProducer ("CutCalculator",
+                collections = producedCollections,
+                cuts = channel
+            )
+            channelPath += cutCalculator
+            setattr (process, channelName + "CutCalculator", cutCalculator)
+            cutDecisions = cms.InputTag (channelName + "CutCalculator", "cutDecisions")
         ########################################################################
 
         ########################################################################
@@ -570,7 +654,7 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
         ########################################################################
         cutFlowPlotter = cms.EDAnalyzer ("CutFlowPlotter",
             collections = producedCollections,
-            cutDecisions = cms.InputTag (channelName + "CutCalculator", "cutDecisions")
+            cutDecisions = cutDecisions
         )
         channelPath += cutFlowPlotter
         setattr (process, channelName + "CutFlowPlotter", cutFlowPlotter)
@@ -581,7 +665,7 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
         ########################################################################
         channelInfoPrinter = copy.deepcopy (infoPrinter)
         channelInfoPrinter.collections = producedCollections
-        channelInfoPrinter.cutDecisions = cms.InputTag (channelName + "CutCalculator", "cutDecisions")
+        channelInfoPrinter.cutDecisions = cutDecisions
         channelPath += channelInfoPrinter
         setattr (process, channelName + "InfoPrinter", channelInfoPrinter)
         ########################################################################
@@ -590,6 +674,11 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
         # For each collection on which cuts are applied, we add the
         # corresponding object selector to the path. We also trade the original
         # collection for the slimmed collection in the output commands.
+        #
+        # If selectByIndex is true, the selectors do not copy the selected
+        # objects. Instead, the modules downstream are given the unfiltered
+        # collection along with the indices of the selected objects. The copy
+        # in the original format is only made if the skim is actually written.
         ########################################################################
         filteredCollections = copy.deepcopy (producedCollections)
         for collection in cutCollections:
@@ -598,17 +687,27 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
             if collection is "uservariables" or collection is "eventvariables":
                 continue
             filterName = collection[0].upper () + collection[1:-1] + "ObjectSelector"
+            filterLabel = "objectSelector" + str (add_channels.filterIndex)
+            byIndex = selectByIndex and collection != "beamspots"
             objectSelector = cms.EDFilter (filterName,
                 collections = producedCollections,
                 collectionToFilter = cms.string (collection),
                 originalCollection = getattr (collections, collection),
-                cutDecisions = cms.InputTag (channelName + "CutCalculator", "cutDecisions")
+                cutDecisions = cutDecisions,
+                copyObjects = cms.bool (not byIndex),
+                saveOriginalFormat = cms.bool (not makeEmptySkim)
             )
             channelPath += objectSelector
-            setattr (process, "objectSelector" + str (add_channels.filterIndex), objectSelector)
-            originalInputTag = getattr (collections, collection)
-            setattr (filteredCollections, collection, cms.InputTag ("objectSelector" + str (add_channels.filterIndex), originalInputTag.getProductInstanceLabel ()))
-            outputCommands.append ("keep *_objectSelector" + str (add_channels.filterIndex) + "_originalFormat_" + process.name_ ())
+            setattr (process, filterLabel, objectSelector)
+            if byIndex:
+                if not hasattr (filteredCollections, "selectedIndices"):
+                    filteredCollections.selectedIndices = cms.PSet ()
+                setattr (filteredCollections.selectedIndices, collection, cms.InputTag (filterLabel, "selectedIndices"))
+            else:
+                originalInputTag = getattr (collections, collection)
+                setattr (filteredCollections, collection, cms.InputTag (filterLabel, originalInputTag.getProductInstanceLabel ()))
+            if not makeEmptySkim:
+                outputCommands.append ("keep *_" + filterLabel + "_originalFormat_" + process.name_ ())
             add_channels.filterIndex += 1
 
         ########################################################################
@@ -663,16 +762,11 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
         # Add a plotting module for this channel to the path.
         ########################################################################
         if len (histogramSets):
-            plotter = cms.EDAnalyzer ("Plotter",
-                collections     =  filteredCollections,
-                histogramSets   =  histogramSets,
-                weights         =  weights,
-                verbose         =  cms.int32 (0)
-            )
-            channelPath += plotter
-            setattr (process, channelName + "Plotter", plotter)
-
-            # Add copies of the plotting module for any weights being fluctuated
+            # Add a weight variation to the plotting module for any weights
+            # being fluctuated. The Plotter fills a copy of every histogram for
+            # each variation, in the directory a separate plotting module for
+            # that variation would have used.
+            weightVariations = cms.VPSet ()
             for weight in weights:
                 # if "fluctuations" is defined in the PSet
                 for fluctuation in (weight.fluctuations if hasattr (weight, "fluctuations") else []):
@@ -681,14 +775,26 @@ def add_channels (process, channels, histogramSets = None, weights = None, scali
                     # now find the weight being fluctuated in the newly copied VPSet
                     for fluctuatedWeight in fluctuatedWeights:
                         if fluctuatedWeight.inputVariable == weight.inputVariable and fluctuatedWeight.inputCollections == weight.inputCollections:
-                            # now change the name of the inputVariable to the fluctuation and add a plotting module for this weights VPSet
+                            # now change the name of the inputVariable to the fluctuation and add a variation for this weights VPSet
                             fluctuatedWeight.inputVariable = fluctuation
-                            fluctuatedPlotter = copy.deepcopy(plotter)
-                            fluctuatedPlotter.weights = fluctuatedWeights
-                            channelPath += fluctuatedPlotter
-                            setattr (process, channelName + "Plotter_" + fluctuation, fluctuatedPlotter)
+                            weightVariations.append (cms.PSet (
+                                directory  =  cms.string (channelName + "Plotter_" + fluctuation),
+                                weights    =  fluctuatedWeights
+                            ))
                             break
 
+            plotter = cms.EDAnalyzer ("Plotter",
+                collections       =  filteredCollections,
+                histogramSets     =  histogramSets,
+                weights           =  weights,
+                weightVariations  =  weightVariations,
+                lazyBooking       =  cms.bool (lazyBooking),
+                sparseHistograms  =  cms.bool (sparseHistograms),
+                verbose           =  cms.int32 (0)
+            )
+            channelPath += plotter
+            setattr (process, channelName + "Plotter", plotter)
+
         ########################################################################
         # Add a tree-making module for this channel to the path.
         ########################################################################
@@ -69,6 +69,7 @@ if arguments.makeSignificancePlots and arguments.makeDiffPlots:
     print "You have asked to make a difference plot and significance plots. This is a very strange request.  Will skip making the difference plot."
     arguments.makeDiffPlots = False
 
+from OSUT3Analysis.Configuration.histogramReader import HistogramReader
 from ROOT import TFile, gROOT, gStyle, gDirectory, TStyle, THStack, TH1F, TCanvas, TString, TLegend, TLegendEntry, THStack, TIter, TKey, TPaveLabel, gPad
 
 
@@ -325,23 +326,20 @@ def MakeOneDHist(histogramDirectory, histogramName,integrateDir):
 
     for source in input_sources: # loop over different input sources in config file
         dataset_file = "condor/%s/%s.root" % (source['condor_dir'],source['dataset'])
-        inputFile = TFile(dataset_file)
-
 
         if arguments.generic:
             if histogramDirectory == "":
                 histPath = histogramName
             else:
                 histPath = histogramDirectory + "/" + histogramName
-            HistogramObj = inputFile.Get(histPath)
+            HistogramObj = reader.get(dataset_file, histPath)
         else:
-            HistogramObj = inputFile.Get(source['channel'] + "Plotter/" + histogramDirectory + "/" + histogramName)
+            HistogramObj = reader.get(dataset_file, source['channel'] + "Plotter/" + histogramDirectory + "/" + histogramName)
         if not HistogramObj:
             print "WARNING:  Could not find histogram " + source['channel'] + "/" + histogramName + " in file " + dataset_file + ".  Will skip it and continue."
             return
         Histogram = HistogramObj.Clone()
         Histogram.SetDirectory(0)
-        inputFile.Close()
         Histogram.Sumw2()
         if arguments.verbose:
             print "  Got histogram", Histogram.GetName(), "from file", dataset_file
@@ -658,6 +656,7 @@ if arguments.outputFileName:
     outputFileName = arguments.outputFileName
 
 outputFile = TFile(outputFileName, "RECREATE")
+reader = HistogramReader()
 
 first_input = input_sources[0]
 
@@ -704,4 +703,5 @@ else:
 
 testFile.Close()
 outputFile.Close()
+reader.close()
 print "Finished writing " + outputFile.GetName()
@@ -9,6 +9,7 @@ import shutil
 
 from array import *
 from optparse import OptionParser
+from multiprocessing import cpu_count
 from OSUT3Analysis.Configuration.configurationOptions import *
 from OSUT3Analysis.Configuration.processingUtilities import *
 from OSUT3Analysis.Configuration.formattingUtilities import *
@@ -57,11 +58,14 @@ parser.add_option("-x", "--xsecTheory", dest="xsecTheory",
                   help="specify file with theory cross sections for each dataset")
 parser.add_option("-i", "--inputFile", dest="inputFile",
                   help="specify inputFile; overrides condor directory")
+parser.add_option("-j", "--jobs", dest="nProcesses", type="int", default=cpu_count(),
+                  help="number of processes for reading the cut flows which are not yet cached [default: %default]")
 
 (arguments, args) = parser.parse_args()
 
 
 from OSUT3Analysis.Configuration.fileUtilities import *  # Import after parsing arguments, to avoid ROOT override of optionparser.
+from OSUT3Analysis.Configuration.cutFlowReader import readCutFlows, getCutFlowDirectories
 from ROOT import TFile
 
 
@@ -358,10 +362,9 @@ def fillTableCuts(table, dataset_file):
     if len(table.cutNames) != 0:
         print "WARNING: Cuts already defined for table; will not add cuts for channel", table.channel
         return
-    inputFile = TFile(dataset_file)
-    cutFlow = inputFile.Get(table.channel + "/cutFlow")
+    cutFlow = cutFlows[dataset_file][table.channel + "/cutFlow"]
     for i in range(1, cutFlow.GetNbinsX()+1):  # Loop over cuts
-        table.cutNames.append(cutFlow.GetXaxis().GetBinLabel(i))
+        table.cutNames.append(cutFlow.GetBinLabel(i))
 
 
 def getLumiWt(dataset_file):
@@ -381,8 +384,7 @@ def getLumiWt(dataset_file):
     return lumiWt
 
 def fillTableColumn(table, dataset_file, dataset, hist_name="cutFlow"):
-    inputFile = TFile(dataset_file)
-    cutFlow = inputFile.Get(table.channel + "/" + hist_name)
+    cutFlow = cutFlows[dataset_file][table.channel + "/" + hist_name]
     if cutFlow.GetNbinsX() != len(table.cutNames):
         print "ERROR:  cutFlow.GetNbinsX() = ", cutFlow.GetNbinsX(), " does not equal len(table.cutNames) = ", len(table.cutNames)
         print "Will skip channel", table.channel, " from file ", dataset_file
@@ -537,34 +539,34 @@ def closeTexFile(texFile):
 
 
 def getProcessedDatasets(condor_dir, datasets):
-    processed_datasets = []
+    # Reads the cut flows of all the datasets at once, from the sidecar files
+    # where they are up to date and otherwise in parallel from the ROOT files.
+    fileNames = []
     for dataset in datasets:
         fileName = condor_dir + "/" + dataset + ".root"
         if not os.path.exists(fileName):
             if (arguments.verbose):
                 print "Couldn't find output file for",dataset,"dataset",fileName,"fileName"
             continue
-        testFile = TFile(fileName)
-        if not (testFile.IsZombie()):
+        fileNames.append(fileName)
+    cutFlows.update(readCutFlows(fileNames, arguments.nProcesses))
+    processed_datasets = []
+    for dataset in datasets:
+        fileName = condor_dir + "/" + dataset + ".root"
+        if cutFlows.get(fileName) is not None:
             processed_datasets.append(dataset)
-        if arguments.verbose:
-            print "Opening testFile: ", fileName
     if len(processed_datasets) is 0:
         sys.exit("Can't find any output root files for the given list of datasets")
     return processed_datasets
 
 
 def getChannels(condor_dir, dataset):
-    # open first input file and re-make its directory structure in the output file
+    # take the channels from the cut flows of the first dataset
     channels = []
-    testFile = TFile(condor_dir + "/" + dataset + ".root")
-    testFile.cd()
-    for key in testFile.GetListOfKeys():
-        if (key.GetClassName() != "TDirectoryFile"):
-            continue
-        if not "CutFlow" in key.GetName():
+    for directory in getCutFlowDirectories(cutFlows[condor_dir + "/" + dataset + ".root"]):
+        if not "CutFlow" in directory:
             continue
-        channels.append(key.GetName())
+        channels.append(directory)
     return channels
 
 
@@ -674,6 +676,7 @@ outputDir = "condor/" + arguments.outputDirectory if arguments.outputDirectory e
 from ROOT import TFile, gROOT, gStyle, gDirectory, TKey
 
 processed_datasets = []
+cutFlows = {}  # cut flows of each dataset file, keyed by "directory/histogram"
 
 outputFileName = "cutFlow"
 if arguments.outputFileName:
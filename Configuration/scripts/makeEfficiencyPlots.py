@@ -69,6 +69,7 @@ if arguments.makeRatioPlots and not arguments.noTGraph:
 
 
 
+from OSUT3Analysis.Configuration.histogramReader import HistogramReader
 from ROOT import TFile, gROOT, gStyle, gDirectory, TStyle, TH1F, TCanvas, TString, TLegend, TLegendEntry, TIter, TKey, TPaveLabel, gPad, TGraphAsymmErrors
 
 
@@ -264,14 +265,12 @@ def MakeOneHist(dirName, histogramName):
 
     for source in input_sources: # loop over different input sources in config file
         dataset_file = "condor/%s/%s.root" % (source['condor_dir'],source['dataset'])
-        inputFile = TFile(dataset_file)
-        NumHistogramObj = inputFile.Get(source['num_channel'] + "Plotter/" + dirName + "/" + histogramName)
+        NumHistogramObj = reader.get(dataset_file, source['num_channel'] + "Plotter/" + dirName + "/" + histogramName)
         if 'condor_dir_den' in source:   # If specified, take the denominator histogram from a different condor directory.
             dataset_fileDen = "condor/%s/%s.root" % (source['condor_dir_den'],source['dataset'])
-            inputFileDen = TFile(dataset_fileDen)
-            DenHistogramObj = inputFileDen.Get(source['den_channel'] + "Plotter/" + dirName + "/" + histogramName)
+            DenHistogramObj = reader.get(dataset_fileDen, source['den_channel'] + "Plotter/" + dirName + "/" + histogramName)
         else:   # Default is to use the same condor directory
-            DenHistogramObj = inputFile.Get(source['den_channel'] + "Plotter/" + dirName + "/" + histogramName)
+            DenHistogramObj = reader.get(dataset_file, source['den_channel'] + "Plotter/" + dirName + "/" + histogramName)
         if not NumHistogramObj:
             print "WARNING:  Could not find histogram " + source['num_channel'] + "Plotter/" + dirName + "/" + histogramName + " in file " + dataset_file + ".  Will skip it and continue."
             return
@@ -285,7 +284,6 @@ def MakeOneHist(dirName, histogramName):
         Histogram.SetDirectory(0)
         DenHistogram = DenHistogramObj.Clone()
         DenHistogram.SetDirectory(0)
-        inputFile.Close()
 
         if arguments.rebinFactor:
             RebinFactor = int(arguments.rebinFactor)
@@ -524,6 +522,7 @@ if arguments.outputFileName:
     outputFileName = arguments.outputFileName
 
 outputFile = TFile(outputFileName, "RECREATE")
+reader = HistogramReader()
 
 outputConfigFile = outputFileName.replace(".root", ".py")
 if os.path.exists(outputConfigFile):
@@ -576,4 +575,5 @@ for key in gDirectory.GetListOfKeys(): # Loop over directories in same way as in
 
 testFile.Close()
 outputFile.Close()
+reader.close()
 print "Finished writing " + outputFile.GetName()
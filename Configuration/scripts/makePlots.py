@@ -6,10 +6,12 @@ import time
 import datetime
 import shutil
 import functools
+import subprocess
+import tempfile
 from math import *
 from array import *
 from decimal import *
-from optparse import OptionParser
+from optparse import OptionParser, SUPPRESS_HELP
 from OSUT3Analysis.Configuration.configurationOptions import *
 from OSUT3Analysis.Configuration.processingUtilities import *
 from OSUT3Analysis.Configuration.formattingUtilities import *
@@ -61,6 +63,12 @@ parser.add_option("-O", "--output-dir", dest="outputDirectory",
                   help="specify an output directory for output file, default is to use the Condor directory")
 parser.add_option("--unique", action="store_true", dest="unique2D",default=False,
                   help="draw 2D plots on unique canvases with the colz option")
+parser.add_option("--prefetch", dest="prefetchProcesses", type="int", default=0,
+                  help="read all histograms up front using this many processes")
+parser.add_option("-j", "--jobs", dest="nJobs", type="int", default=1,
+                  help="split the histograms among this many processes")
+parser.add_option("--shard", dest="shard", help=SUPPRESS_HELP)
+parser.add_option("--shardOutput", dest="shardOutput", help=SUPPRESS_HELP)
 
 
 (arguments, args) = parser.parse_args()
@@ -111,6 +119,7 @@ if arguments.makeSignificancePlots and arguments.makeDiffPlots:
     arguments.makeDiffPlots = False
 
 from OSUT3Analysis.Configuration.histogramUtilities import ratioHistogram
+from OSUT3Analysis.Configuration.histogramReader import HistogramReader
 from ROOT import Math, TFile, gROOT, gStyle, gDirectory, TStyle, THStack, TH1, TH1F, TCanvas, TString, TLegend, TLegendEntry, THStack, TIter, TKey, TPaveLabel, gPad, TGraphAsymmErrors
 
 
@@ -639,16 +648,13 @@ def MakeOneDHist(pathToDir,histogramName,integrateDir):
     for sample in processed_datasets: # loop over different samples as listed in configurationOptions.py
         dataset_file = "%s/%s.root" % (condor_dir,sample)
         condorDir = condor_dir
-        inputFile = TFile(dataset_file)
-        HistogramObj = inputFile.Get(pathToDir+"/"+histogramName)
+        HistogramObj = reader.get(dataset_file, pathToDir+"/"+histogramName)
         if not HistogramObj:
             print "WARNING:  Could not find histogram " + pathToDir + "/" + histogramName + " in file " + dataset_file + ".  Will skip it and continue."
             continue
         Histogram = HistogramObj.Clone()
         Histogram.SetDirectory(0)
 
-        inputFile.Close()
-
         # correct bin contents of object multiplcity plots
         if Histogram.GetName().startswith("num") and "PV" not in Histogram.GetName():
             # include overflow bin
@@ -1370,14 +1376,12 @@ def MakeTwoDHist(pathToDir,histogramName):
         if arguments.verbose:
             print "Starting to process sample", sample
         dataset_file = "%s/%s.root" % (condor_dir,sample)
-        inputFile = TFile(dataset_file)
-        HistogramObj = inputFile.Get(pathToDir+"/"+histogramName)
+        HistogramObj = reader.get(dataset_file, pathToDir+"/"+histogramName)
         if not HistogramObj:
             print "WARNING:  Could not find histogram " + pathToDir + "/" + histogramName + " in file " + dataset_file + ".  Will skip it and continue."
             continue
         Histogram = HistogramObj.Clone()
         Histogram.SetDirectory(0)
-        inputFile.Close()
         if arguments.rebinFactor:
             RebinFactor = int(arguments.rebinFactor)
             #don't rebin histograms which will have less than 5 bins or any gen-matching histograms
@@ -1569,6 +1573,7 @@ if arguments.paperConfig:
 condor_dir = set_condor_output_dir(arguments)
 
 #### check which input datasets have valid output files
+reader = HistogramReader()
 if arguments.verbose:
     print "Number of datasets: " + str(len(datasets))
     print datasets
@@ -1579,22 +1584,22 @@ for sample in datasets:
     if not os.path.exists(fileName):
         print "WARNING: didn't find ",fileName
         continue
-    testFile = TFile(fileName)
-    if testFile.IsZombie() or not testFile.GetNkeys():
+    testFile = reader.open(fileName)
+    if not testFile or not testFile.GetNkeys():
         continue
     processed_datasets.append(sample)
 
 if len(processed_datasets) is 0:
     sys.exit("No datasets have been processed")
 
-if arguments.savePDFs:
+if arguments.savePDFs and not arguments.shard:
     try:
         shutil.rmtree ("%s/stacked_histograms_pdfs" % (condor_dir))
     except OSError:
         pass
     os.mkdir ("%s/stacked_histograms_pdfs" % (condor_dir))
 
-if arguments.savePNGs:
+if arguments.savePNGs and not arguments.shard:
     try:
         shutil.rmtree ("%s/stacked_histograms_pngs" % (condor_dir))
     except OSError:
@@ -1617,94 +1622,146 @@ if arguments.makeSignificancePlots:
 if arguments.outputFileName:
     outputFileName = arguments.outputFileName
 outputDir = "condor/" + arguments.outputDirectory if arguments.outputDirectory else condor_dir
+outputPath = outputDir + "/" + outputFileName
+if arguments.shard:
+    outputPath = arguments.shardOutput
 
-outputFile = TFile(outputDir + "/" + outputFileName, "RECREATE")
-
-#### use the first input file as a template and make stacked versions of all its histograms
+#### use the first input file as a template and list the directories and histograms to draw, in the order they appear in it
 inputFile = TFile(condor_dir + "/" + processed_datasets[0] + ".root")
-inputFile.cd()
-outputFile.cd()
+directories = []
+histogramsToDraw = []
+
+def addHistogram(directory, key):
+    if re.match ('TH1', key.GetClassName()): # found a 1-D histogram
+        histogramsToDraw.append((directory, key.GetName(), "TH1"))
+    elif re.match ('TH2', key.GetClassName()) and arguments.draw2DPlots: # found a 2-D histogram
+        histogramsToDraw.append((directory, key.GetName(), "TH2"))
 
 #get root directory in the first layer, generally "OSUAnalysis"
 for key in inputFile.GetListOfKeys():
     if (key.GetClassName() != "TDirectoryFile"):
         continue
     rootDirectory = key.GetName()
-    outputFile.mkdir(rootDirectory)
-    if arguments.savePDFs:
-        os.mkdir ("%s/stacked_histograms_pdfs/%s" % (condor_dir,plainTextString(rootDirectory)))
-    if arguments.savePNGs:
-        os.mkdir ("%s/stacked_histograms_pngs/%s" % (condor_dir,plainTextString(rootDirectory)))
+    directories.append(rootDirectory)
 
     #cd to root directory and look for histograms
     inputFile.cd(rootDirectory)
     for key2 in gDirectory.GetListOfKeys():
+        if (key2.GetClassName() != "TDirectoryFile"):
+            addHistogram(rootDirectory, key2)
+            continue
+
+        #####################################################
+        ###  This layer is typically the "channels" layer ###
+        #####################################################
+
+        level2Directory = rootDirectory+"/"+key2.GetName()
+        directories.append(level2Directory)
+        inputFile.cd(level2Directory)
+        for key3 in gDirectory.GetListOfKeys():
+#            if arguments.quickHistName and not arguments.quickHistName in key3.GetName():
+            if arguments.quickHistName and not arguments.quickHistName == key3.GetName():
+                continue
+            if (key3.GetClassName() != "TDirectoryFile"):
+                addHistogram(level2Directory, key3)
+                continue
+
+            #################################################
+            ###  This layer is typically the "cuts" layer ###
+            #################################################
 
-        if re.match ('TH1', key2.GetClassName()): # found a 1-D histogram
+            level3Directory = level2Directory+"/"+key3.GetName()
+            directories.append(level3Directory)
+            inputFile.cd(level3Directory)
+            for key4 in gDirectory.GetListOfKeys():
+                addHistogram(level3Directory, key4)
+
+inputFile.Close()
+
+#### make the corresponding directories in the output file, and for the PDFs and PNGs
+outputFile = TFile(outputPath, "RECREATE")
+for directory in directories:
+    parent, name = os.path.split(directory)
+    if parent:
+        outputFile.cd(parent)
+    else:
+        outputFile.cd()
+    gDirectory.mkdir(name)
+    if arguments.savePDFs and not arguments.shard:
+        os.mkdir ("%s/stacked_histograms_pdfs/%s" % (condor_dir,plainTextString(directory)))
+    if arguments.savePNGs and not arguments.shard:
+        os.mkdir ("%s/stacked_histograms_pngs/%s" % (condor_dir,plainTextString(directory)))
+
+#### split the histograms into contiguous shards, one per worker, so that
+#### concatenating the workers' output in order reproduces the serial order
+def getShard(histograms, shard, nShards):
+    return histograms[(shard * len(histograms)) / nShards : ((shard + 1) * len(histograms)) / nShards]
+
+nJobs = max(1, min(arguments.nJobs, len(histogramsToDraw)))
+if arguments.shard:
+    shard, nShards = map(int, arguments.shard.split("/"))
+    histogramsToDraw = getShard(histogramsToDraw, shard, nShards)
+    nJobs = 1
+
+if nJobs > 1:
+    #### run each shard in a separate batch-mode ROOT process writing to its own temporary file
+    shardDir = tempfile.mkdtemp(prefix = ".makePlots_", dir = outputDir)
+    shardOutputs = [shardDir + "/shard_" + str(shard) + ".root" for shard in range(nJobs)]
+    workers = []
+    for shard in range(nJobs):
+        command = [sys.executable, os.path.abspath(sys.argv[0])] + sys.argv[1:] + ["--shard", str(shard) + "/" + str(nJobs), "--shardOutput", shardOutputs[shard]]
+        workers.append(subprocess.Popen(command))
+    failedWorkers = [shard for shard in range(nJobs) if workers[shard].wait()]
+
+    #### merge the shards in shard order, copying every key, including any at
+    #### the top level, into the directories created above
+    def mergeDirectory(source, destination):
+        copied = set()
+        for key in source.GetListOfKeys():
+            if key.GetName() in copied: # keep only the highest cycle of each key
+                continue
+            copied.add(key.GetName())
+            if key.GetClassName() == "TDirectoryFile":
+                subdirectory = destination.GetDirectory(key.GetName()) or destination.mkdir(key.GetName())
+                mergeDirectory(source.GetDirectory(key.GetName()), subdirectory)
+                continue
+            obj = key.ReadObj()
+            destination.cd()
+            obj.Write(key.GetName())
+
+    if not failedWorkers:
+        for shard in range(nJobs):
+            shardFile = TFile(shardOutputs[shard])
+            if not shardFile or shardFile.IsZombie():
+                failedWorkers.append(shard)
+                break
+            mergeDirectory(shardFile, outputFile)
+            shardFile.Close()
+    shutil.rmtree(shardDir)
+
+    #### do not leave a partial output behind if any shard failed
+    if failedWorkers:
+        outputFile.Close()
+        os.remove(outputPath)
+        reader.close()
+        sys.exit("Plotting failed for shard(s) " + ", ".join(map(str, failedWorkers)) + "; no output was written.")
+else:
+    #### read every histogram which will be plotted in one pass per dataset
+    if arguments.prefetchProcesses:
+        reader.prefetch([(condor_dir + "/" + sample + ".root", directory + "/" + histogramName) for sample in processed_datasets for (directory, histogramName, histogramType) in histogramsToDraw], arguments.prefetchProcesses)
+
+    #### make stacked versions of all the histograms
+    for (directory, histogramName, histogramType) in histogramsToDraw:
+        if histogramType == "TH1":
             if arguments.makeSignificancePlots or arguments.makeCumulativePlots:
-                MakeOneDHist(rootDirectory,key2.GetName(),"left")
-                MakeOneDHist(rootDirectory,key2.GetName(),"right")
+                MakeOneDHist(directory,histogramName,"left")
+                MakeOneDHist(directory,histogramName,"right")
             else:
-                MakeOneDHist(rootDirectory,key2.GetName(),"none")
-        elif re.match ('TH2', key2.GetClassName()) and arguments.draw2DPlots: # found a 2-D histogram
-            MakeTwoDHist(rootDirectory,key2.GetName())
-
-        elif (key2.GetClassName() == "TDirectoryFile"): # found a directory, cd there and look for histograms
-            level2Directory = rootDirectory+"/"+key2.GetName()
-
-            #make a corresponding directory in the output file
-            outputFile.cd(rootDirectory)
-            gDirectory.mkdir(key2.GetName())
-            if arguments.savePDFs:
-                os.mkdir ("%s/stacked_histograms_pdfs/%s" % (condor_dir,plainTextString(level2Directory)))
-            if arguments.savePNGs:
-                os.mkdir ("%s/stacked_histograms_pngs/%s" % (condor_dir,plainTextString(level2Directory)))
-
-            #####################################################
-            ###  This layer is typically the "channels" layer ###
-            #####################################################
-
-            inputFile.cd(level2Directory)
-            for key3 in gDirectory.GetListOfKeys():
-#                if arguments.quickHistName and not arguments.quickHistName in key3.GetName():
-                if arguments.quickHistName and not arguments.quickHistName == key3.GetName():
-                    continue
-                if re.match ('TH1', key3.GetClassName()): # found a 1-D histogram
-                    if arguments.makeSignificancePlots or arguments.makeCumulativePlots:
-                        MakeOneDHist(level2Directory,key3.GetName(),"left")
-                        MakeOneDHist(level2Directory,key3.GetName(),"right")
-                    else:
-                        MakeOneDHist(level2Directory,key3.GetName(),"none")
-                elif re.match ('TH2', key3.GetClassName()) and arguments.draw2DPlots: # found a 2-D histogram
-                    MakeTwoDHist(level2Directory,key3.GetName())
-
-                elif (key3.GetClassName() == "TDirectoryFile"): # found a directory, cd there and look for histograms
-                    level3Directory = level2Directory+"/"+key3.GetName()
-
-                    #make a corresponding directory in the output file
-                    outputFile.cd(level2Directory)
-                    gDirectory.mkdir(key3.GetName())
-                    if arguments.savePDFs:
-                        os.mkdir ("%s/stacked_histograms_pdfs/%s" % (condor_dir,plainTextString(level3Directory)))
-                    if arguments.savePNGs:
-                        os.mkdir ("%s/stacked_histograms_pngs/%s" % (condor_dir,plainTextString(level3Directory)))
-
-                    #################################################
-                    ###  This layer is typically the "cuts" layer ###
-                    #################################################
-
-                    inputFile.cd(level3Directory)
-                    for key3 in gDirectory.GetListOfKeys():
-                        if re.match ('TH1', key3.GetClassName()): # found a 1-D histogram
-                            if arguments.makeSignificancePlots or arguments.makeCumulativePlots:
-                                MakeOneDHist(level3Directory,key3.GetName(),"left")
-                                MakeOneDHist(level3Directory,key3.GetName(),"right")
-                            else:
-                                MakeOneDHist(level3Directory,key3.GetName(),"none")
-                        elif re.match ('TH2', key3.GetClassName()) and arguments.draw2DPlots: # found a 2-D histogram
-                            MakeTwoDHist(level3Directory,key3.GetName())
-
+                MakeOneDHist(directory,histogramName,"none")
+        else:
+            MakeTwoDHist(directory,histogramName)
 
 outputFile.Close()
-print "Finished writing plots to", str(outputDir + "/" + outputFileName)
-
+reader.close()
+if not arguments.shard:
+    print "Finished writing plots to", str(outputPath)
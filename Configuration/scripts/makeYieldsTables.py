@@ -6,6 +6,7 @@ import math
 from array import *
 from decimal import *
 from optparse import OptionParser
+from multiprocessing import cpu_count
 from OSUT3Analysis.Configuration.configurationOptions import *
 from OSUT3Analysis.Configuration.processingUtilities import *
 from OSUT3Analysis.Configuration.formattingUtilities import *
@@ -36,6 +37,8 @@ parser.add_option("-S", "--systematics", action="store_true", dest="includeSyste
                                     help="also lists the systematic uncertainties")
 parser.add_option("-i", "--inputHistogram", dest="inputHistogram",
                   help="choose an input histogram and calculate the yield from its integral (histogram should be filled once per event)")
+parser.add_option("-j", "--jobs", dest="nProcesses", type="int", default=cpu_count(),
+                  help="number of processes for reading the cut flows which are not yet cached [default: %default]")
 
 (arguments, args) = parser.parse_args()
 
@@ -55,6 +58,7 @@ condor_dir = set_condor_output_dir(arguments)
 
 
 from ROOT import TFile, TH1F, gDirectory, Double
+from OSUT3Analysis.Configuration.cutFlowReader import readCutFlows, getCutFlowDirectories
 
 
 hLine = "\\hline\n"
@@ -117,15 +121,19 @@ def getSystematicError(sample):
 
 
 
-#### check which input datasets have valid output files
-processed_datasets = []
+#### check which input datasets have valid output files, reading the cut flows
+#### of all of them at once
+fileNames = []
 for dataset in datasets:
     fileName = condor_dir + "/" + dataset + ".root"
     if not os.path.exists(fileName):
         "input file not found for ",dataset,"dataset"
         continue
-    testFile = TFile(fileName)
-    if not (testFile.IsZombie()):
+    fileNames.append(fileName)
+cutFlows = readCutFlows(fileNames, arguments.nProcesses)
+processed_datasets = []
+for dataset in datasets:
+    if cutFlows.get(condor_dir + "/" + dataset + ".root") is not None:
         processed_datasets.append(dataset)
 
 #### exit if no datasets found
@@ -134,17 +142,14 @@ if len(processed_datasets) is 0:
     sys.exit("Can't find any output root files for the given list of datasets")
 
 
-#open the first ROOT file and get the list of channels
+#get the list of channels from the cut flows of the first dataset
 channels = []
 dataset_file = "%s/%s.root" % (condor_dir,processed_datasets[0])
-inputFile = TFile(dataset_file)
 
-for key in gDirectory.GetListOfKeys():
-    if (key.GetClassName() != "TDirectoryFile"):
-        continue
-    if "CutFlowPlotter" not in key.GetName():
+for directory in getCutFlowDirectories(cutFlows[dataset_file]):
+    if "CutFlowPlotter" not in directory:
         continue
-    channels.append(key.GetName())
+    channels.append(directory)
 
 #get and store the yields and errors for each dataset
 yields = {}
@@ -166,10 +171,11 @@ for sample in processed_datasets:
     stat_errors[sample] = {}
     sys_errors[sample] = {}
     dataset_file = "%s/%s.root" % (condor_dir,sample)
-    inputFile = TFile(dataset_file)
+    if arguments.inputHistogram:
+        inputFile = TFile(dataset_file)
     for channel in channels:
         if not arguments.inputHistogram:
-            cutFlowHistogram = inputFile.Get(channel+"/cutFlow")
+            cutFlowHistogram = cutFlows[dataset_file].get(channel+"/cutFlow")
             if not cutFlowHistogram:
                 print "WARNING: didn't find cutflow for ", sample, "dataset in", channel, "channel"
                 continue
@@ -205,7 +211,8 @@ for sample in processed_datasets:
             bgMCStatErrSquared[channel] = bgMCStatErrSquared[channel] + statError_*statError_
             bgMCSysErrSquared[channel] = bgMCSysErrSquared[channel] + sysError_*sysError_
 
-    inputFile.Close()
+    if arguments.inputHistogram:
+        inputFile.Close()
 
 
 #write a table for each channel to a separate tex file
@@ -26,6 +26,8 @@ parser.add_option("-N", "--noExec", action="store_true", dest="NotToExecute", de
 parser.add_option("-O", "--output-dir", dest="outputDirectory", help="specify an output directory for output file, default is to use the Condor directory")
 parser.add_option("-v", "--verbose", action="store_true", dest="verbose", default=False,
                   help="verbose output")
+parser.add_option("--fanIn", dest="fanIn", type="int", default=100, help="Specify the maximum number of files merged by each merging step.")
+parser.add_option("--mergeSkims", action="store_true", dest="mergeSkims", default=False, help="Also merge the skim files of each channel into merged/skimMerged.root, concurrently with the histograms.")
 
 (arguments, args) = parser.parse_args()
 
@@ -80,7 +82,7 @@ if arguments.verbose:
     print "List of datasets: ", split_datasets
 if not arguments.compositeOnly and not arguments.UseCondor:
     for dataSet in split_datasets:
-        mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir, verbose = arguments.verbose)
+        mergeOneDataset(dataSet, IntLumi, CondorDir, OutputDir, verbose = arguments.verbose, fanIn = arguments.fanIn, mergeSkims = arguments.mergeSkims)
 
 if arguments.UseCondor:
     # Make necessary files for condor and submit condor jobs.
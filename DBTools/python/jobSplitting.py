@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+
+# Splitting of a dataset into jobs with roughly equal numbers of events.
+#
+# The number of events in each input file is read from its Events tree, or
+# from a metadata cache of previously read counts, and the files are then packed
+# into jobs. Files with more events than a job should process are split into
+# event ranges, each of which becomes a job of its own, since skipEvents and
+# maxEvents apply to the job as a whole.
+
+import heapq
+import math
+from multiprocessing import Pool, cpu_count
+from OSUT3Analysis.DBTools.metadataCache import MetadataCache
+
+def _readNumberOfEvents(fileName):
+    # Runs in a worker process, so ROOT is only imported there.
+    from ROOT import TFile
+    nEvents = -1
+    inputFile = TFile.Open(fileName)
+    if inputFile and not inputFile.IsZombie():
+        events = inputFile.Get("Events")
+        if events:
+            nEvents = int(events.GetEntries())
+        inputFile.Close()
+    return (fileName, nEvents)
+
+# Returns the number of events in each of the given files, in the same order.
+# Files missing from the cache are opened by a pool of worker processes. Files
+# which cannot be read are given -1 events and are not cached.
+def getNumberOfEvents(files, cacheName = "", nProcesses = cpu_count()):
+    cache = MetadataCache(cacheName)
+    counts = {}
+    filesToRead = []
+    for fileName in files:
+        nEvents = cache.get(fileName, "events")
+        if nEvents is None:
+            filesToRead.append(fileName)
+        else:
+            counts[fileName] = nEvents
+
+    if filesToRead:
+        print "Reading the number of events in " + str(len(filesToRead)) + " files..."
+        if nProcesses > 1 and len(filesToRead) > 1:
+            pool = Pool(min(nProcesses, len(filesToRead)))
+            results = pool.map(_readNumberOfEvents, filesToRead)
+            pool.close()
+            pool.join()
+        else:
+            results = map(_readNumberOfEvents, filesToRead)
+        for fileName, nEvents in results:
+            counts[fileName] = nEvents
+            if nEvents >= 0:
+                cache.set(fileName, "events", nEvents)
+        cache.save()
+
+    return [counts[fileName] for fileName in files]
+
+# Splits the files into nJobs jobs with equal numbers of files, as is done in
+# osusub_cfg.py when the jobs are not balanced. Jobs without any files are
+# dropped.
+def splitByFiles(files, nJobs):
+    nJobs = max(1, int(nJobs))
+    filesPerJob = len(files) / nJobs
+    residualLength = len(files) % nJobs
+    jobs = []
+    for jobNumber in range(nJobs):
+        if jobNumber < residualLength:
+            jobFiles = files[(jobNumber * filesPerJob + jobNumber):(jobNumber * filesPerJob + filesPerJob + jobNumber + 1)]
+        else:
+            jobFiles = files[(jobNumber * filesPerJob + residualLength):(jobNumber * filesPerJob + residualLength + filesPerJob)]
+        if jobFiles:
+            jobs.append((jobFiles, 0, -1))
+    return jobs
+
+# Splits the files into approximately nJobs jobs with equal numbers of events.
+# Returns a list of (files, skipEvents, maxEvents) tuples, one per job, with
+# maxEvents equal to -1 for jobs which process their files entirely. If the
+# number of events in any file is unknown, the files are split evenly by their
+# number instead. Files without any events are skipped.
+def balanceJobs(files, eventCounts, nJobs):
+    nJobs = max(1, int(nJobs))
+    unknownFiles = [fileName for fileName, nEvents in zip(files, eventCounts) if nEvents < 0]
+    if unknownFiles:
+        print "WARNING: could not read the number of events in " + str(len(unknownFiles)) + " of " + str(len(files)) + " files, e.g., " + unknownFiles[0] + "."
+        print "Splitting the files evenly into jobs by their number instead."
+        return splitByFiles(files, nJobs)
+    emptyFiles = [fileName for fileName, nEvents in zip(files, eventCounts) if nEvents == 0]
+    if emptyFiles:
+        print "WARNING: skipping " + str(len(emptyFiles)) + " files without any events, e.g., " + emptyFiles[0] + "."
+
+    totalEvents = sum(eventCounts)
+    eventsPerJob = max(1, int(math.ceil(totalEvents / float(nJobs))))
+
+    jobs = []
+    smallFiles = []
+    for fileName, nEvents in zip(files, eventCounts):
+        if nEvents > eventsPerJob:
+            # split into ranges of nearly equal size rather than leaving a
+            # small remainder at the end of the file
+            nRanges = int(math.ceil(nEvents / float(eventsPerJob)))
+            rangeSize = int(math.ceil(nEvents / float(nRanges)))
+            for skipEvents in range(0, nEvents, rangeSize):
+                jobs.append(([fileName], skipEvents, min(rangeSize, nEvents - skipEvents)))
+        elif nEvents > 0:
+            smallFiles.append((nEvents, fileName))
+
+    if smallFiles:
+        # Longest-processing-time-first packing: each file, from the largest
+        # to the smallest, goes to the job with the fewest events so far.
+        smallEvents = sum([nEvents for nEvents, fileName in smallFiles])
+        nBins = max(1, min(len(smallFiles), int(math.ceil(smallEvents / float(eventsPerJob)))))
+        bins = [(0, i, []) for i in range(nBins)]
+        for nEvents, fileName in sorted(smallFiles, reverse = True):
+            binEvents, i, binFiles = heapq.heappop(bins)
+            binFiles.append(fileName)
+            heapq.heappush(bins, (binEvents + nEvents, i, binFiles))
+        # keep the files of each job in their original order
+        order = dict([(fileName, i) for i, fileName in enumerate(files)])
+        for binEvents, i, binFiles in sorted(bins, key = lambda x: x[1]):
+            jobs.append((sorted(binFiles, key = lambda x: order[x]), 0, -1))
+
+    return jobs
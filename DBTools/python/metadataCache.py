@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+
+# Persistent cache of metadata about ROOT files, e.g., numbers of events, cut
+# flow totals and validation results, so that each file only needs to be opened
+# once across submission, resubmission and merging.
+#
+# The cache is a JSON file. Local files are keyed by their real path and
+# stamped with their size and modification time; all cached metadata for a file
+# is discarded once either changes. Remote files are keyed by their URL and
+# assumed to be immutable.
+
+import json
+import os
+
+def _localPath(fileName):
+    if fileName.startswith("file:"):
+        return fileName[5:]
+    if "://" in fileName:
+        return None
+    return fileName
+
+def _fileKeyAndStamp(fileName):
+    path = _localPath(fileName)
+    if path is None:
+        return (fileName, None)
+    path = os.path.realpath(path)
+    try:
+        status = os.stat(path)
+    except OSError:
+        return (path, None)
+    return (path, [status.st_size, status.st_mtime])
+
+class MetadataCache:
+
+    def __init__(self, cacheName):
+        self._cacheName = cacheName
+        self._entries = {}
+        self._modified = False
+        if cacheName and os.path.isfile(cacheName):
+            try:
+                fin = open(cacheName)
+                self._entries = json.load(fin)
+                fin.close()
+            except ValueError:
+                print "WARNING: could not read metadata cache " + cacheName + ". Ignoring it."
+                self._entries = {}
+
+    # Returns the value stored for the given file and key, or None if there is
+    # none or the file has changed since it was stored.
+    def get(self, fileName, key):
+        path, stamp = _fileKeyAndStamp(fileName)
+        entry = self._entries.get(path)
+        if entry is None or entry["stamp"] != stamp:
+            return None
+        return entry.get(key)
+
+    def set(self, fileName, key, value):
+        path, stamp = _fileKeyAndStamp(fileName)
+        entry = self._entries.get(path)
+        if entry is None or entry["stamp"] != stamp:
+            entry = {"stamp" : stamp}
+            self._entries[path] = entry
+        entry[key] = value
+        self._modified = True
+
+    def save(self):
+        if not self._cacheName or not self._modified:
+            return
+        fout = open(self._cacheName + ".tmp", "w")
+        json.dump(self._entries, fout, indent = 1, sort_keys = True)
+        fout.close()
+        os.rename(self._cacheName + ".tmp", self._cacheName)
+        self._modified = False
@@ -1,5 +1,7 @@
 import sys
 import math
+skipEvents = 0
+maxEvents = -1
 # For jobs with input datasets, normal cases: cmsRun config_cfg.py True 671 $(Process) /DYJetsToLL_M-50_TuneCUETP8M1_13TeV-amcatnloFXFX-pythia8/RunIISpring15DR74-Asympt25ns_MCRUN2_74_V9-v3/MINIAODSIM DYJetsToLL_50_MiniAOD
 if len (sys.argv) == 7 and sys.argv[2] == "True":
   nJobs = float (sys.argv[3])
@@ -7,12 +9,17 @@ if len (sys.argv) == 7 and sys.argv[2] == "True":
   jobNumber = int (sys.argv[4])
   if int (sys.argv[3]) != 0 and sys.argv[5] != "NULL":
     exec("import datasetInfo_" + Label +"_cfg as datasetInfo")
-    filesPerJob = int (math.floor (len (datasetInfo.listOfFiles) / nJobs))
-    residualLength = int(len(datasetInfo.listOfFiles)%nJobs)
-    if jobNumber < residualLength:
-        runList = datasetInfo.listOfFiles[(jobNumber * filesPerJob + jobNumber):(jobNumber * filesPerJob + filesPerJob + jobNumber + 1)]
+    # If the jobs were balanced by number of events, each job has its own
+    # list of files and possibly a range of events within a single file.
+    if hasattr (datasetInfo, "jobs"):
+      runList, skipEvents, maxEvents = datasetInfo.jobs[jobNumber]
     else:
-        runList = datasetInfo.listOfFiles[(jobNumber * filesPerJob + residualLength):(jobNumber * filesPerJob + residualLength + filesPerJob)]
+      filesPerJob = int (math.floor (len (datasetInfo.listOfFiles) / nJobs))
+      residualLength = int(len(datasetInfo.listOfFiles)%nJobs)
+      if jobNumber < residualLength:
+          runList = datasetInfo.listOfFiles[(jobNumber * filesPerJob + jobNumber):(jobNumber * filesPerJob + filesPerJob + jobNumber + 1)]
+      else:
+          runList = datasetInfo.listOfFiles[(jobNumber * filesPerJob + residualLength):(jobNumber * filesPerJob + residualLength + filesPerJob)]
     secondaryRunList = datasetInfo.listOfSecondaryFiles
   dataset = sys.argv[5]
   datasetLabel = sys.argv[6]
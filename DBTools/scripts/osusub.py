@@ -19,6 +19,7 @@ from OSUT3Analysis.Configuration.configurationOptions import *
 from OSUT3Analysis.Configuration.processingUtilities import *
 from OSUT3Analysis.Configuration.formattingUtilities import *
 from OSUT3Analysis.DBTools.condorSubArgumentsSet import *
+from OSUT3Analysis.DBTools.jobSplitting import getNumberOfEvents, balanceJobs
 
 parser = OptionParser()
 parser = set_commandline_arguments(parser)
@@ -64,6 +65,8 @@ parser.add_option("--resubmit", dest="Resubmit", action="store_true", default =
 parser.add_option("--redirector", dest="Redirector", default = "", help="Setup the redirector for xrootd service to use")
 parser.add_option("--extend", dest="Extend", action="store_true", default = False, help="Use unique random seeds for this job")  # See https://cmshead.mps.ohio-state.edu:8080/OSUT3Analysis/65
 parser.add_option("--inputDirectory", dest="inputDirectory", default = "", help="Specify the directory containing input files. Wildcards allowed.")
+parser.add_option("--balanceEvents", dest="BalanceEvents", action="store_true", default = False, help="Split the input files into jobs with roughly equal numbers of events, splitting large files by event range.")
+parser.add_option("--eventCountCache", dest="EventCountCache", default = "condor/metadataCache.json", help="Specify the file in which the numbers of events in the input files are cached for --balanceEvents. Skims use the cache written by mergeOut.py in the skim directory instead.")
 
 (arguments, args) = parser.parse_args()
 
@@ -623,6 +626,12 @@ def MakeSpecificConfig(Dataset, Directory, SkimDirectory, Label, SkimChannelName
         #If there are input datasets, on could set the MaxEvents to be -1.
         if EventsPerJob < 0:
             ConfigFile.write('pset.process.maxEvents.input = cms.untracked.int32 (' + str(EventsPerJob) + ')\n')
+        #If the jobs are balanced by number of events, a job may only process a range of events in its file.
+        if arguments.BalanceEvents and EventsPerJob < 0:
+            ConfigFile.write('if osusub.skipEvents > 0:\n')
+            ConfigFile.write('    pset.process.source.skipEvents = cms.untracked.uint32 (osusub.skipEvents)\n')
+            ConfigFile.write('if osusub.maxEvents > 0:\n')
+            ConfigFile.write('    pset.process.maxEvents.input = cms.untracked.int32 (osusub.maxEvents)\n')
     #If there are no input datasets, one needs a positive MaxEvents.
     if jsonFile != '':
         ConfigFile.write('pset.process.source.lumisToProcess = cms.untracked.VLuminosityBlockRange()\n')
@@ -850,6 +859,30 @@ def MakeFileList(Dataset, FileType, Directory, Label, UseAAA, crossSection):
         datasetRead['secondaryCollections'] = secondaryCollectionModifications
     return  datasetRead
 
+#It splits the files in the dataset into jobs with roughly equal numbers of events and records the resulting jobs in datasetInfo_cfg.py, where osusub_cfg.py looks for them. It returns the number of jobs.
+def BalanceJobsByEvents(Directory, Label, NumberOfJobs):
+    datasetInfoName = Directory + '/datasetInfo_' + Label + '_cfg.py'
+    datasetInfo = {}
+    execfile(datasetInfoName, datasetInfo)
+    listOfFiles = datasetInfo['listOfFiles']
+    cacheName = arguments.EventCountCache
+    if RunOverSkim:
+        cacheName = Condor + arguments.SkimDirectory + '/' + Label + '/metadataCache.json'
+    eventCounts = getNumberOfEvents(listOfFiles, cacheName)
+    jobs = balanceJobs(listOfFiles, eventCounts, NumberOfJobs)
+    if not jobs:
+        print "No events found in the input files for dataset " + Label + ".  Will not balance its jobs."
+        return NumberOfJobs
+    text = 'jobs = [\n'
+    for files, skipEvents, maxEvents in jobs:
+        text += '    ([' + ', '.join(['"' + f + '"' for f in files]) + '], ' + str(skipEvents) + ', ' + str(maxEvents) + '),\n'
+    text += ']\n'
+    fnew = open(datasetInfoName, "a")
+    fnew.write(text)
+    fnew.close()
+    print 'Balanced ' + str(sum([n for n in eventCounts if n > 0])) + ' events in ' + str(len(listOfFiles)) + ' files into ' + str(len(jobs)) + ' jobs for ' + str(Label) + ' dataset.'
+    return len(jobs)
+
 def MakeBatchJobFile(WorkDir, Queue, NumberOfJobs):
     LxBatchSubFile = open(currentDir + WorkDir + '/lxbatchSub.sh','w')
     LxBatchSubFile.write('#!/bin/sh\n')
@@ -1183,7 +1216,11 @@ if not arguments.Resubmit:
                 NumberOfEvents = int(DatasetRead['numberOfEvents'])
                 if arguments.NumberOfEventsPerJob > 0:
                     NumberOfJobs = max(1,int(math.ceil(NumberOfEvents/int(arguments.NumberOfEventsPerJob))))
-            if NumberOfJobs > NumberOfFiles:
+            if arguments.BalanceEvents and EventsPerJob > 0:
+                print "Cannot balance the jobs by number of events when the maximum number of events is set.  Will split by files instead."
+            elif arguments.BalanceEvents:
+                NumberOfJobs = BalanceJobsByEvents(WorkDir, dataset, NumberOfJobs)
+            if NumberOfJobs > NumberOfFiles and not (arguments.BalanceEvents and EventsPerJob < 0):
                 NumberOfJobs = NumberOfFiles
 
 
@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+
+# Offline test of the job splitting in DBTools/python/jobSplitting.py, using
+# synthetic numbers of events so that no input files are needed:
+#
+#   python testJobSplitting.py
+
+import random
+import unittest
+from OSUT3Analysis.DBTools.jobSplitting import balanceJobs, splitByFiles
+
+def eventsInJob(job, eventCounts):
+    files, skipEvents, maxEvents = job
+    if maxEvents < 0:
+        return sum([eventCounts[f] for f in files])
+    return maxEvents
+
+class BalanceJobsTest(unittest.TestCase):
+
+    def checkEveryEventOnce(self, files, eventCounts, jobs):
+        counts = dict(zip(files, eventCounts))
+        processed = dict([(f, []) for f in files])
+        for fileNames, skipEvents, maxEvents in jobs:
+            self.assertTrue(len(fileNames) > 0)
+            if maxEvents < 0:
+                self.assertEqual(skipEvents, 0)
+                for f in fileNames:
+                    processed[f].append((0, counts[f]))
+            else:
+                self.assertEqual(len(fileNames), 1)
+                processed[fileNames[0]].append((skipEvents, skipEvents + maxEvents))
+        for f in files:
+            ranges = sorted(processed[f])
+            if counts[f] == 0:
+                self.assertEqual(ranges, [])
+                continue
+            self.assertEqual(ranges[0][0], 0)
+            self.assertEqual(ranges[-1][1], counts[f])
+            for previous, current in zip(ranges[:-1], ranges[1:]):
+                self.assertEqual(previous[1], current[0])
+
+    def testBalanced(self):
+        random.seed(1)
+        for nFiles, nJobs in [(1, 1), (1, 7), (10, 3), (50, 10), (200, 17)]:
+            files = ["file_" + str(i) + ".root" for i in range(nFiles)]
+            eventCounts = [random.choice([0, random.randint(1, 100), random.randint(1, 10000)]) for f in files]
+            if not sum(eventCounts):
+                eventCounts[0] = 1
+            jobs = balanceJobs(files, eventCounts, nJobs)
+            self.checkEveryEventOnce(files, eventCounts, jobs)
+            counts = dict(zip(files, eventCounts))
+            eventsPerJob = -(-sum(eventCounts) // nJobs)
+            # each job is at most about one job's worth of events more than
+            # the target, which a single small file can add
+            for job in jobs:
+                self.assertTrue(eventsInJob(job, counts) <= 2 * eventsPerJob)
+
+    def testLargeFileIsSplit(self):
+        jobs = balanceJobs(["a.root", "b.root"], [1000, 10], 4)
+        self.checkEveryEventOnce(["a.root", "b.root"], [1000, 10], jobs)
+        self.assertTrue(len([job for job in jobs if job[0] == ["a.root"] and job[2] > 0]) >= 3)
+
+    def testEmptyFilesAreSkipped(self):
+        jobs = balanceJobs(["a.root", "b.root", "c.root"], [0, 5, 0], 1)
+        self.assertEqual(jobs, [(["b.root"], 0, -1)])
+        jobs = balanceJobs(["a.root", "b.root", "c.root"], [0, 5, 0], 2)
+        self.assertEqual(jobs, [(["b.root"], 0, 3), (["b.root"], 3, 2)])
+
+    def testUnknownCountFallsBackToFileSplit(self):
+        files = ["file_" + str(i) + ".root" for i in range(10)]
+        eventCounts = [100] * 10
+        eventCounts[3] = -1
+        for nJobs in [1, 3, 4, 10, 25]:
+            jobs = balanceJobs(files, eventCounts, nJobs)
+            self.assertEqual(jobs, splitByFiles(files, nJobs))
+            self.assertEqual(len(jobs), min(nJobs, len(files)))
+            self.assertEqual(sum([job[0] for job in jobs], []), files)
+
+    def testSplitByFilesMatchesOsusubCfg(self):
+        files = ["file_" + str(i) + ".root" for i in range(11)]
+        self.assertEqual([job[0] for job in splitByFiles(files, 4)],
+                         [files[0:3], files[3:6], files[6:9], files[9:11]])
+
+if __name__ == "__main__":
+    unittest.main()
@@ -24,7 +24,7 @@ void
 MyVariableProducer::AddVariables (const edm::Event &event) {
 
   // Add all of the needed collections to objectsToGet_
-  objectsToGet_.insert ("muon");
+  objectsToGet_.insert ("muons");
 
   // get all the needed collections from the event and put them into the "handles_" collection
   //anatools::getRequiredCollections (objectsToGet_, collections_, handles_, event);
@@ -34,7 +34,8 @@ MyVariableProducer::AddVariables (const edm::Event &event) {
   double muonPt = 0.;
 
   // simple case, just muonPt
-  for (const auto &muon1 : *handles_.muons) {
+  // loop over the muons which passed the cuts, as given by selectedIndices
+  for (const auto &muon1 : anatools::selectedObjects (handles_.muons, handles_, "muons")) {
     muonPt = muon1.pt();
     //double value = anatools::getMember(muon1, "pt");
     //addUserVar("muonPt", value, muon1);
@@ -57,6 +58,8 @@ MyVariableProducer::getOriginalCollections (const unordered_set<string> &objects
   if  (VEC_CONTAINS  (objectsToGet,  "primaryvertexs"))  event.getByToken  (tokens_.primaryvertexs,  handles_.primaryvertexs);
   if  (VEC_CONTAINS  (objectsToGet,  "pileupinfos"))     event.getByToken  (tokens_.pileupinfos,     handles_.pileupinfos);
   if  (VEC_CONTAINS  (objectsToGet,  "triggers"))        event.getByToken  (tokens_.triggers,        handles_.triggers);
+
+  getSelectedIndices (objectsToGet, event, handles_.selectedIndices);
 }
 
 
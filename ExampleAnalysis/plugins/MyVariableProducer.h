@@ -15,6 +15,8 @@ struct OriginalCollections
   edm::Handle<vector<reco::Vertex> >        primaryvertexs;
   edm::Handle<vector<PileupSummaryInfo>>    pileupinfos;
   edm::Handle<edm::TriggerResults>          triggers;
+
+  unordered_map<string, edm::Handle<vector<unsigned> > >  selectedIndices;
 };
 
 struct OriginalTokens
@@ -0,0 +1,18 @@
+#!/bin/sh
+# If the headers or selection file from which AnaTools/src/AccessorTable.cc is
+# generated are being committed, check that the table is up to date.
+
+if git rev-parse --verify HEAD >/dev/null 2>&1
+then
+    against=HEAD
+else
+    #Initial commit: diff against an empty tree object
+    against=4b825dc642cb6eb9a060e54bf8d69288fbee4904
+fi
+
+if git diff-index --cached --name-only $against -- Collections/interface Collections/src/classes_def.xml AnaTools/src/AccessorTable.cc | grep -q .
+then
+  top=$(git rev-parse --show-toplevel)
+  exec 1>&2
+  exec python $top/AnaTools/scripts/generateAccessorTable.py -b $top -c
+fi